@@ -1,9 +1,22 @@
 #ifndef S21_AVL_H
 #define S21_AVL_H
 
+#include <functional>
 #include <iostream>
-
-template <class Key, class Value>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+// Each node stores one Value: either the key itself (Value == Key, as for
+// sets and multisets) or a std::pair<const Key, T> whose first member is the
+// key (maps), so iterators hand out references into the node. InsertNode
+// keeps keys unique; InsertEqualNode places an equal key after the ones
+// already there. Nodes are allocated
+// through Allocator rebound to the node type. Keys are ordered by Compare;
+// when Compare::is_transparent exists, lookups also accept any type Compare
+// can order against Key, without building a Key.
+template <class Key, class Value, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Value>>
 class s21_AVLTree {
  protected:
   struct Node;
@@ -16,12 +29,21 @@ class s21_AVLTree {
   using value_type = Value;
   using reference = value_type&;
   using const_reference = const value_type&;
+  using pointer = value_type*;
   using iterator = Iterator;
   using const_iterator = ConstIterator;
   using size_type = size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
 
   class Iterator {
    public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = s21_AVLTree::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = s21_AVLTree::pointer;
+    using reference = s21_AVLTree::reference;
+
     Iterator();
     Iterator(Node* node, Node* past_node = nullptr);
     iterator& operator++();
@@ -29,8 +51,9 @@ class s21_AVLTree {
     iterator& operator--();
     iterator operator--(int);
     reference operator*();
+    pointer operator->() { return &operator*(); };
     bool operator==(const iterator& it);
-    friend class s21_AVLTree<Key, Value>;
+    friend class s21_AVLTree<Key, Value, Compare, Allocator>;
     bool operator!=(const iterator& it);
 
    protected:
@@ -47,11 +70,16 @@ class s21_AVLTree {
   };
 
   s21_AVLTree();
+  explicit s21_AVLTree(const Allocator& alloc);
+  explicit s21_AVLTree(const Compare& comp,
+                       const Allocator& alloc = Allocator());
   s21_AVLTree(const s21_AVLTree& other);
   s21_AVLTree(s21_AVLTree&& other) noexcept;
   ~s21_AVLTree();
-  s21_AVLTree& operator=(s21_AVLTree&& other) noexcept;
+  s21_AVLTree& operator=(s21_AVLTree&& other) noexcept(kNothrowMoveAssign);
   s21_AVLTree& operator=(const s21_AVLTree& other);
+  allocator_type get_allocator() { return allocator_type(node_alloc_); }
+  key_compare key_comp() const { return comp_; }
   iterator begin();
   iterator end();
   bool empty();
@@ -63,89 +91,169 @@ class s21_AVLTree {
   void swap(s21_AVLTree& other);
   void merge(s21_AVLTree& other);
   bool contains(const Key& key);
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K& key) {
+    return FindNode(root_, key) != nullptr;
+  };
 
  protected:
   iterator Find(const Key& key);
   struct Node {
-    Node(Key key, value_type value);
-    Node(Key key, value_type value, Node* parent);
-    Key key_;
-    value_type value_;
+    template <typename... Args>
+    explicit Node(Node* parent, Args&&... args)
+        : data_(std::forward<Args>(args)...), parent_(parent){};
+    value_type data_;
     Node* left_ = nullptr;
     Node* right_ = nullptr;
     Node* parent_ = nullptr;
     int height_ = 0;
-    friend class s21_AVLTree<Key, Value>;
+    friend class s21_AVLTree<Key, Value, Compare, Allocator>;
     ;
   };
 
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  // Move assignment only throws when it has to move values into new nodes.
+  static constexpr bool kNothrowMoveAssign =
+      node_traits::propagate_on_container_move_assignment::value ||
+      node_traits::is_always_equal::value;
+
+  node_allocator node_alloc_;
+  Compare comp_;
   Node* root_;
+  size_type size_;
 
+  template <typename... Args>
+  Node* CreateNode(Args&&... args);
+  void DestroyNode(Node* node);
   void FreeNode(Node* node);
+  template <bool kMove>
   Node* CopyTree(Node* node, Node* parent);
-  void SwapValue(Node* a, Node* b);
-  void RightRotate(Node* node);
-  void LeftRotate(Node* node);
-  void Balance(Node* node);
+  Node* RightRotate(Node* node);
+  Node* LeftRotate(Node* node);
+  Node* Balance(Node* node);
   int GetBalance(Node* node);
   int GetHeight(Node* node);
   void SetHeight(Node* node);
   static Node* GetMin(Node* node);
   static Node* GetMax(Node* node);
-  bool RecursiveInsert(Node* node, const Key& key, Value value);
-  Node* RecursiveDelete(Node* node, Key key);
-  size_t RecursiveSize(Node* node);
-  Node* RecursiveFind(Node* node, const Key& key);
+  static const Key& KeyOf(const Node* node);
+  template <typename... Args>
+  std::pair<Node*, bool> InsertNode(const Key& key, Args&&... args);
+  template <typename... Args>
+  Node* InsertEqualNode(const Key& key, Args&&... args);
+  template <bool kUnique>
+  std::pair<Node*, Node**> FindLink(const Key& key);
+  void LinkNode(Node* parent, Node** link, Node* node);
+  void UnlinkNode(Node* node);
+  void EraseNode(Node* node);
+  template <bool kUnique>
+  void MergeNodes(s21_AVLTree& other);
+  void ReplaceChild(Node* node, Node* child);
+  template <class K>
+  Node* FindNode(Node* node, const K& key);
+  template <class K>
+  Node* LowerBoundNode(const K& key);
+  template <class K>
+  Node* UpperBoundNode(const K& key);
+  iterator IteratorAt(Node* node);
 };
 
 #include <sys/types.h>
 
 #include <limits>
 
-template <class Key, class Value>
-s21_AVLTree<Key, Value>::s21_AVLTree() : root_(nullptr) {}
-
-template <class Key, class Value>
-s21_AVLTree<Key, Value>::s21_AVLTree(const s21_AVLTree &other)
-    : root_(CopyTree(other.root_, nullptr)) {}
-
-template <class Key, class Value>
-s21_AVLTree<Key, Value>::s21_AVLTree(s21_AVLTree &&other) noexcept {
+template <class Key, class Value, class Compare, class Allocator>
+s21_AVLTree<Key, Value, Compare, Allocator>::s21_AVLTree()
+    : s21_AVLTree(Compare()) {}
+
+template <class Key, class Value, class Compare, class Allocator>
+s21_AVLTree<Key, Value, Compare, Allocator>::s21_AVLTree(
+    const Allocator &alloc)
+    : s21_AVLTree(Compare(), alloc) {}
+
+template <class Key, class Value, class Compare, class Allocator>
+s21_AVLTree<Key, Value, Compare, Allocator>::s21_AVLTree(
+    const Compare &comp, const Allocator &alloc)
+    : node_alloc_(alloc), comp_(comp), root_(nullptr), size_(0) {}
+
+template <class Key, class Value, class Compare, class Allocator>
+s21_AVLTree<Key, Value, Compare, Allocator>::s21_AVLTree(
+    const s21_AVLTree &other)
+    : node_alloc_(
+          node_traits::select_on_container_copy_construction(
+              other.node_alloc_)),
+      comp_(other.comp_),
+      root_(nullptr),
+      size_(0) {
+  root_ = CopyTree<false>(other.root_, nullptr);
+  size_ = other.size_;
+}
+
+template <class Key, class Value, class Compare, class Allocator>
+s21_AVLTree<Key, Value, Compare, Allocator>::s21_AVLTree(
+    s21_AVLTree &&other) noexcept
+    : node_alloc_(other.node_alloc_),
+      comp_(other.comp_),
+      root_(nullptr),
+      size_(0) {
   std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
 }
 
-template <class Key, class Value>
-s21_AVLTree<Key, Value>::~s21_AVLTree() {
+template <class Key, class Value, class Compare, class Allocator>
+s21_AVLTree<Key, Value, Compare, Allocator>::~s21_AVLTree() {
   clear();
 }
 
-template <class Key, class Value>
-s21_AVLTree<Key, Value> &s21_AVLTree<Key, Value>::operator=(
-    s21_AVLTree &&other) noexcept {
-  if (this != &other) {
+// Nodes change hands when the allocator follows them (or both allocators are
+// interchangeable); otherwise the values are moved into fresh nodes.
+template <class Key, class Value, class Compare, class Allocator>
+s21_AVLTree<Key, Value, Compare, Allocator> &
+s21_AVLTree<Key, Value, Compare, Allocator>::operator=(
+    s21_AVLTree &&other) noexcept(kNothrowMoveAssign) {
+  if (this == &other) return *this;
+  clear();
+  comp_ = other.comp_;
+  if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+    node_alloc_ = other.node_alloc_;
+  }
+  if (node_alloc_ == other.node_alloc_) {
     std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+  } else {
+    root_ = CopyTree<true>(other.root_, nullptr);
+    size_ = other.size_;
+    other.clear();
   }
   return *this;
 }
 
-template <class Key, class Value>
-s21_AVLTree<Key, Value> &s21_AVLTree<Key, Value>::operator=(
+template <class Key, class Value, class Compare, class Allocator>
+s21_AVLTree<Key, Value, Compare, Allocator> &
+s21_AVLTree<Key, Value, Compare, Allocator>::operator=(
     const s21_AVLTree &other) {
-  if (this != &other) {
-    s21_AVLTree temp(other);
-    FreeNode(root_);
-    *this = std::move(temp);
+  if (this == &other) return *this;
+  clear();
+  comp_ = other.comp_;
+  if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+    node_alloc_ = other.node_alloc_;
   }
+  root_ = CopyTree<false>(other.root_, nullptr);
+  size_ = other.size_;
   return *this;
 }
 
-template <class Key, class Value>
-typename s21_AVLTree<Key, Value>::Iterator s21_AVLTree<Key, Value>::begin() {
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Iterator
+s21_AVLTree<Key, Value, Compare, Allocator>::begin() {
   return s21_AVLTree::Iterator(GetMin(root_));
 }
 
-template <class Key, class Value>
-typename s21_AVLTree<Key, Value>::Iterator s21_AVLTree<Key, Value>::end() {
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Iterator
+s21_AVLTree<Key, Value, Compare, Allocator>::end() {
   if (root_ == nullptr) return begin();
 
   Node *last_node = GetMax(root_);
@@ -153,83 +261,76 @@ typename s21_AVLTree<Key, Value>::Iterator s21_AVLTree<Key, Value>::end() {
   return test;
 }
 
-template <class Key, class Value>
-bool s21_AVLTree<Key, Value>::empty() {
+template <class Key, class Value, class Compare, class Allocator>
+bool s21_AVLTree<Key, Value, Compare, Allocator>::empty() {
   return root_ == nullptr;
 }
 
-template <class Key, class Value>
-size_t s21_AVLTree<Key, Value>::size() {
-  return RecursiveSize(root_);
+template <class Key, class Value, class Compare, class Allocator>
+size_t s21_AVLTree<Key, Value, Compare, Allocator>::size() {
+  return size_;
 }
 
-template <class Key, class Value>
-size_t s21_AVLTree<Key, Value>::max_size() {
+template <class Key, class Value, class Compare, class Allocator>
+size_t s21_AVLTree<Key, Value, Compare, Allocator>::max_size() {
   return std::numeric_limits<size_type>::max() /
-         sizeof(typename s21_AVLTree<Key, Value>::Node);
+         sizeof(typename s21_AVLTree<Key, Value, Compare, Allocator>::Node);
 }
 
-template <class Key, class Value>
-void s21_AVLTree<Key, Value>::clear() {
+template <class Key, class Value, class Compare, class Allocator>
+void s21_AVLTree<Key, Value, Compare, Allocator>::clear() {
   if (root_ != nullptr) FreeNode(root_);
   root_ = nullptr;
+  size_ = 0;
 }
 
-template <class Key, class Value>
-std::pair<typename s21_AVLTree<Key, Value>::Iterator, bool>
-s21_AVLTree<Key, Value>::insert(const Key &key) {
-  std::pair<Iterator, bool> return_value;
-  if (root_ == nullptr) {
-    root_ = new Node(key, key);
-    return_value.first = Iterator(root_);
-    return_value.second = true;
-  } else {
-    bool check_insert = RecursiveInsert(root_, key, key);
-    return_value.first = Find(key);
-    return_value.second = check_insert;
-  }
-
-  return return_value;
+template <class Key, class Value, class Compare, class Allocator>
+std::pair<typename s21_AVLTree<Key, Value, Compare, Allocator>::Iterator, bool>
+s21_AVLTree<Key, Value, Compare, Allocator>::insert(const Key &key) {
+  std::pair<Node *, bool> inserted = InsertNode(key, key);
+  return {Iterator(inserted.first), inserted.second};
 }
 
-template <class Key, class Value>
-void s21_AVLTree<Key, Value>::erase(iterator pos) {
+template <class Key, class Value, class Compare, class Allocator>
+void s21_AVLTree<Key, Value, Compare, Allocator>::erase(iterator pos) {
   if (root_ == nullptr || pos.iter_node_ == nullptr) return;
-  root_ = RecursiveDelete(root_, *pos);
+  EraseNode(pos.iter_node_);
 }
 
-template <class Key, class Value>
-void s21_AVLTree<Key, Value>::swap(s21_AVLTree &other) {
+// Allocators are exchanged only when they propagate on swap; otherwise they
+// must compare equal.
+template <class Key, class Value, class Compare, class Allocator>
+void s21_AVLTree<Key, Value, Compare, Allocator>::swap(s21_AVLTree &other) {
+  if constexpr (node_traits::propagate_on_container_swap::value) {
+    std::swap(node_alloc_, other.node_alloc_);
+  }
+  std::swap(comp_, other.comp_);
   std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
 }
 
-template <class Key, class Value>
-void s21_AVLTree<Key, Value>::merge(s21_AVLTree &other) {
-  s21_AVLTree const_tree(other);
-  Iterator const_it = const_tree.begin();
-
-  for (; const_it != const_tree.end(); ++const_it) {
-    std::pair<Iterator, bool> pr = insert(*const_it);
-    if (pr.second) other.erase(pr.first);
-  }
+template <class Key, class Value, class Compare, class Allocator>
+void s21_AVLTree<Key, Value, Compare, Allocator>::merge(s21_AVLTree &other) {
+  MergeNodes<true>(other);
 }
 
-template <class Key, class Value>
-typename s21_AVLTree<Key, Value>::iterator s21_AVLTree<Key, Value>::Find(
-    const Key &key) {
-  Node *exact_node = RecursiveFind(root_, key);
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::iterator
+s21_AVLTree<Key, Value, Compare, Allocator>::Find(const Key &key) {
+  Node *exact_node = FindNode(root_, key);
   return Iterator(exact_node);
 }
 
-template <class Key, class Value>
-bool s21_AVLTree<Key, Value>::contains(const Key &key) {
-  Node *contain_node = RecursiveFind(root_, key);
+template <class Key, class Value, class Compare, class Allocator>
+bool s21_AVLTree<Key, Value, Compare, Allocator>::contains(const Key &key) {
+  Node *contain_node = FindNode(root_, key);
   return !(contain_node == nullptr);
 }
 
-template <class Key, class Value>
-typename s21_AVLTree<Key, Value>::Node *
-s21_AVLTree<Key, Value>::Iterator::MoveForward(s21_AVLTree::Node *node) {
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *
+s21_AVLTree<Key, Value, Compare, Allocator>::Iterator::MoveForward(
+    s21_AVLTree::Node *node) {
   if (node->right_ != nullptr) {
     return GetMin(node->right_);
   }
@@ -244,9 +345,10 @@ s21_AVLTree<Key, Value>::Iterator::MoveForward(s21_AVLTree::Node *node) {
   return parent;
 }
 
-template <class Key, class Value>
-typename s21_AVLTree<Key, Value>::Node *
-s21_AVLTree<Key, Value>::Iterator::MoveBack(s21_AVLTree::Node *node) {
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *
+s21_AVLTree<Key, Value, Compare, Allocator>::Iterator::MoveBack(
+    s21_AVLTree::Node *node) {
   if (node->left_ != nullptr) {
     return GetMax(node->left_);
   }
@@ -261,18 +363,18 @@ s21_AVLTree<Key, Value>::Iterator::MoveBack(s21_AVLTree::Node *node) {
   return parent;
 }
 
-template <class Key, class Value>
-s21_AVLTree<Key, Value>::Iterator::Iterator()
+template <class Key, class Value, class Compare, class Allocator>
+s21_AVLTree<Key, Value, Compare, Allocator>::Iterator::Iterator()
     : iter_node_(nullptr), iter_past_node_(nullptr) {}
 
-template <class Key, class Value>
-s21_AVLTree<Key, Value>::Iterator::Iterator(s21_AVLTree::Node *node,
-                                            s21_AVLTree::Node *past_node)
+template <class Key, class Value, class Compare, class Allocator>
+s21_AVLTree<Key, Value, Compare, Allocator>::Iterator::Iterator(
+    s21_AVLTree::Node *node, s21_AVLTree::Node *past_node)
     : iter_node_(node), iter_past_node_(past_node) {}
 
-template <class Key, class Value>
-typename s21_AVLTree<Key, Value>::iterator &
-s21_AVLTree<Key, Value>::Iterator::operator++() {
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::iterator &
+s21_AVLTree<Key, Value, Compare, Allocator>::Iterator::operator++() {
   Node *tmp;
 
   if (iter_node_ != nullptr) {
@@ -288,17 +390,17 @@ s21_AVLTree<Key, Value>::Iterator::operator++() {
   return *this;
 }
 
-template <class Key, class Value>
-typename s21_AVLTree<Key, Value>::iterator
-s21_AVLTree<Key, Value>::Iterator::operator++(int) {
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::iterator
+s21_AVLTree<Key, Value, Compare, Allocator>::Iterator::operator++(int) {
   Iterator temp = *this;
   operator++();
   return temp;
 }
 
-template <class Key, class Value>
-typename s21_AVLTree<Key, Value>::iterator &
-s21_AVLTree<Key, Value>::Iterator::operator--() {
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::iterator &
+s21_AVLTree<Key, Value, Compare, Allocator>::Iterator::operator--() {
   if (iter_node_ == nullptr && iter_past_node_ != nullptr) {
     *this = iter_past_node_;
     return *this;
@@ -309,254 +411,405 @@ s21_AVLTree<Key, Value>::Iterator::operator--() {
   return *this;
 }
 
-template <class Key, class Value>
-typename s21_AVLTree<Key, Value>::iterator
-s21_AVLTree<Key, Value>::Iterator::operator--(int) {
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::iterator
+s21_AVLTree<Key, Value, Compare, Allocator>::Iterator::operator--(int) {
   Iterator temp = *this;
   operator--();
   return temp;
 }
 
-template <class Key, class Value>
-Value &s21_AVLTree<Key, Value>::Iterator::operator*() {
+template <class Key, class Value, class Compare, class Allocator>
+Value &s21_AVLTree<Key, Value, Compare, Allocator>::Iterator::operator*() {
   if (iter_node_ == nullptr) {
     static Value fake_value{};
     return fake_value;
   }
-  return iter_node_->key_;
+  return iter_node_->data_;
 }
 
-template <class Key, class Value>
-bool s21_AVLTree<Key, Value>::Iterator::operator==(
+template <class Key, class Value, class Compare, class Allocator>
+bool s21_AVLTree<Key, Value, Compare, Allocator>::Iterator::operator==(
     const s21_AVLTree::iterator &it) {
   return iter_node_ == it.iter_node_;
 }
 
-template <class Key, class Value>
-bool s21_AVLTree<Key, Value>::Iterator::operator!=(
+template <class Key, class Value, class Compare, class Allocator>
+bool s21_AVLTree<Key, Value, Compare, Allocator>::Iterator::operator!=(
     const s21_AVLTree::iterator &it) {
   return !operator==(it);
 }
 
-template <class Key, class Value>
-s21_AVLTree<Key, Value>::Node::Node(Key key, value_type value)
-    : key_(key), value_(value) {}
-
-template <class Key, class Value>
-s21_AVLTree<Key, Value>::Node::Node(Key key, value_type value, Node *node)
-    : key_(key), value_(value), parent_(node) {}
-
-template <class Key, class Value>
-typename s21_AVLTree<Key, Value>::Node *s21_AVLTree<Key, Value>::CopyTree(
+// Rebuilds the subtree below node with the same shape in nodes from our
+// allocator, moving the values out with kMove. Nothing is left behind on
+// exception.
+template <class Key, class Value, class Compare, class Allocator>
+template <bool kMove>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *
+s21_AVLTree<Key, Value, Compare, Allocator>::CopyTree(
     s21_AVLTree::Node *node, s21_AVLTree::Node *parent) {
   if (node == nullptr) return nullptr;
 
-  Node *new_node = new Node(node->key_, node->value_, parent);
-  new_node->left_ = CopyTree(node->left_, new_node);
-  new_node->right_ = CopyTree(node->right_, new_node);
+  Node *new_node;
+  if constexpr (kMove) {
+    new_node = CreateNode(parent, std::move(node->data_));
+  } else {
+    new_node = CreateNode(parent, node->data_);
+  }
+  new_node->height_ = node->height_;
+  try {
+    new_node->left_ = CopyTree<kMove>(node->left_, new_node);
+    new_node->right_ = CopyTree<kMove>(node->right_, new_node);
+  } catch (...) {
+    FreeNode(new_node);
+    throw;
+  }
   return new_node;
 }
 
-template <class Key, class Value>
-void s21_AVLTree<Key, Value>::FreeNode(Node *node) {
+template <class Key, class Value, class Compare, class Allocator>
+void s21_AVLTree<Key, Value, Compare, Allocator>::FreeNode(Node *node) {
   if (node == nullptr) return;
   FreeNode(node->left_);
   FreeNode(node->right_);
-  delete node;
+  DestroyNode(node);
+}
+
+template <class Key, class Value, class Compare, class Allocator>
+template <typename... Args>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *
+s21_AVLTree<Key, Value, Compare, Allocator>::CreateNode(Args &&...args) {
+  Node *node = node_traits::allocate(node_alloc_, 1);
+  try {
+    node_traits::construct(node_alloc_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(node_alloc_, node, 1);
+    throw;
+  }
+  return node;
 }
 
-template <class Key, class Value>
-int s21_AVLTree<Key, Value>::GetHeight(s21_AVLTree::Node *node) {
-  return node == nullptr ? -1 : node->height_;
+template <class Key, class Value, class Compare, class Allocator>
+void s21_AVLTree<Key, Value, Compare, Allocator>::DestroyNode(Node *node) {
+  node_traits::destroy(node_alloc_, node);
+  node_traits::deallocate(node_alloc_, node, 1);
 }
 
-template <class Key, class Value>
-int s21_AVLTree<Key, Value>::GetBalance(s21_AVLTree::Node *node) {
-  return node == nullptr ? 0 : GetHeight(node->right_) - GetHeight(node->left_);
-}
-
-template <class Key, class Value>
-void s21_AVLTree<Key, Value>::SetHeight(s21_AVLTree::Node *node) {
-  node->height_ = std::max(GetHeight(node->left_), GetHeight(node->right_) + 1);
+template <class Key, class Value, class Compare, class Allocator>
+int s21_AVLTree<Key, Value, Compare, Allocator>::GetHeight(
+    s21_AVLTree::Node *node) {
+  return node == nullptr ? -1 : node->height_;
 }
 
-template <class Key, class Value>
-void s21_AVLTree<Key, Value>::SwapValue(s21_AVLTree::Node *a,
-                                        s21_AVLTree::Node *b) {
-  std::swap(a->key_, b->key_);
-  std::swap(a->value_, b->value_);
+template <class Key, class Value, class Compare, class Allocator>
+int s21_AVLTree<Key, Value, Compare, Allocator>::GetBalance(
+    s21_AVLTree::Node *node) {
+  return node == nullptr ? 0 : GetHeight(node->right_) - GetHeight(node->left_);
 }
 
-template <typename Key, typename Value>
-void s21_AVLTree<Key, Value>::RightRotate(s21_AVLTree::Node *node) {
-  Node *new_left = node->left_->left_;
-  Node *new_right_right = node->right_;
-  Node *new_right_left = node->left_->right_;
-
-  SwapValue(node, node->left_);
-  node->right_ = node->left_;
-
-  node->left_ = new_left;
-  if (node->left_) {
-    node->left_->parent_ = node;
-  }
-
-  node->right_->left_ = new_right_left;
-  if (node->right_->left_) {
-    node->right_->left_->parent_ = node->right_;
-  }
-
-  node->right_->right_ = new_right_right;
-  if (node->right_->right_) {
-    node->right_->right_->parent_ = node->right_;
-  }
+template <class Key, class Value, class Compare, class Allocator>
+void s21_AVLTree<Key, Value, Compare, Allocator>::SetHeight(
+    s21_AVLTree::Node *node) {
+  node->height_ = std::max(GetHeight(node->left_), GetHeight(node->right_)) + 1;
+}
+
+// Rotations only relink pointers: payloads stay in their nodes, so the cost
+// does not depend on sizeof(Value) and iterators stay valid. Both return the
+// new root of the subtree.
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *
+s21_AVLTree<Key, Value, Compare, Allocator>::RightRotate(Node *node) {
+  Node *pivot = node->left_;
+  node->left_ = pivot->right_;
+  if (node->left_ != nullptr) node->left_->parent_ = node;
+  ReplaceChild(node, pivot);
+  pivot->right_ = node;
+  node->parent_ = pivot;
 
-  SetHeight(node->right_);
   SetHeight(node);
+  SetHeight(pivot);
+  return pivot;
 }
 
-template <typename Key, typename Value>
-void s21_AVLTree<Key, Value>::LeftRotate(s21_AVLTree::Node *node) {
-  Node *new_right = node->right_->right_;
-  Node *new_left_left = node->left_;
-  Node *new_left_right = node->right_->left_;
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *
+s21_AVLTree<Key, Value, Compare, Allocator>::LeftRotate(Node *node) {
+  Node *pivot = node->right_;
+  node->right_ = pivot->left_;
+  if (node->right_ != nullptr) node->right_->parent_ = node;
+  ReplaceChild(node, pivot);
+  pivot->left_ = node;
+  node->parent_ = pivot;
 
-  SwapValue(node, node->right_);
-  node->left_ = node->right_;
-
-  node->right_ = new_right;
-  if (node->right_) {
-    node->right_->parent_ = node;
-  }
-
-  node->left_->right_ = new_left_right;
-  if (node->left_->right_) {
-    node->left_->right_->parent_ = node->left_;
-  }
-
-  node->left_->left_ = new_left_left;
-  if (node->left_->left_) {
-    node->left_->left_->parent_ = node->left_;
-  }
-
-  SetHeight(node->left_);
   SetHeight(node);
+  SetHeight(pivot);
+  return pivot;
 }
 
-template <typename Key, typename Value>
-void s21_AVLTree<Key, Value>::Balance(
+// Returns the root of the rebalanced subtree.
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *
+s21_AVLTree<Key, Value, Compare, Allocator>::Balance(
     Node *node) {  // правила балансировки чтобы понять какой вид поворота нужен
   int balance = GetBalance(node);
   if (balance == -2) {
     if (GetBalance(node->left_) == 1) LeftRotate(node->left_);
-    RightRotate(node);
-  } else if (balance == 2) {
+    return RightRotate(node);
+  }
+  if (balance == 2) {
     if (GetBalance(node->right_) == -1) RightRotate(node->right_);
-    LeftRotate(node);
+    return LeftRotate(node);
   }
+  return node;
 }
 
 // MIN AND MAX IN TREE
 
-template <typename Key, typename Value>
-typename s21_AVLTree<Key, Value>::Node *s21_AVLTree<Key, Value>::GetMin(
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *
+s21_AVLTree<Key, Value, Compare, Allocator>::GetMin(
     s21_AVLTree::Node *node) {
   if (node == nullptr) return nullptr;
-  if (node->left_ == nullptr) return node;
-  return GetMin(node->left_);
+  while (node->left_ != nullptr) node = node->left_;
+  return node;
 }
 
-template <typename Key, typename Value>
-typename s21_AVLTree<Key, Value>::Node *s21_AVLTree<Key, Value>::GetMax(
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *
+s21_AVLTree<Key, Value, Compare, Allocator>::GetMax(
     s21_AVLTree::Node *node) {
   if (node == nullptr) return nullptr;
-  if (node->right_ == nullptr) return node;
-  return GetMax(node->right_);
-}
-
-// RECURSIVE SUPPORT FUNCTIONS
-
-template <typename Key, typename Value>
-size_t s21_AVLTree<Key, Value>::RecursiveSize(s21_AVLTree::Node *node) {
-  if (node == nullptr) return 0;
-  size_t left_size = RecursiveSize(node->left_);
-  size_t right_size = RecursiveSize(node->right_);
-  return 1 + left_size + right_size;
-}
-
-template <typename Key, typename Value>
-bool s21_AVLTree<Key, Value>::RecursiveInsert(
-    s21_AVLTree::Node *node, const Key &key,
-    Value value) {  // Рекурсивная вставка в дерево с добавленной логикой
-                    // понимания произошла ли вставка на самом деле, возвращает
-                    // также указатель на ноду
-  bool check_insert = false;
-  if (key < node->key_) {
-    if (node->left_ == nullptr) {
-      node->left_ = new Node(key, value, node);
-      check_insert = true;
+  while (node->right_ != nullptr) node = node->right_;
+  return node;
+}
+
+template <class Key, class Value, class Compare, class Allocator>
+const Key &s21_AVLTree<Key, Value, Compare, Allocator>::KeyOf(
+    const Node *node) {
+  if constexpr (std::is_same_v<Key, Value>) {
+    return node->data_;
+  } else {
+    return node->data_.first;
+  }
+}
+
+// INSERT AND ERASE
+
+// Walks down once to the insertion point and builds the value from args only
+// when the key is new.
+template <class Key, class Value, class Compare, class Allocator>
+template <typename... Args>
+std::pair<typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *, bool>
+s21_AVLTree<Key, Value, Compare, Allocator>::InsertNode(
+    const Key &key, Args &&...args) {
+  auto [parent, link] = FindLink<true>(key);
+  if (link == nullptr) return {parent, false};
+  Node *inserted = CreateNode(parent, std::forward<Args>(args)...);
+  LinkNode(parent, link, inserted);
+  return {inserted, true};
+}
+
+template <class Key, class Value, class Compare, class Allocator>
+template <typename... Args>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *
+s21_AVLTree<Key, Value, Compare, Allocator>::InsertEqualNode(
+    const Key &key, Args &&...args) {
+  auto [parent, link] = FindLink<false>(key);
+  Node *inserted = CreateNode(parent, std::forward<Args>(args)...);
+  LinkNode(parent, link, inserted);
+  return inserted;
+}
+
+// Returns the empty link where key belongs and the node it hangs from. Equal
+// keys go to the right, after the ones already in the tree; with kUnique an
+// equal key stops the walk instead and comes back with a null link.
+template <class Key, class Value, class Compare, class Allocator>
+template <bool kUnique>
+std::pair<typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *,
+          typename s21_AVLTree<Key, Value, Compare, Allocator>::Node **>
+s21_AVLTree<Key, Value, Compare, Allocator>::FindLink(const Key &key) {
+  Node *parent = nullptr;
+  Node **link = &root_;
+  while (*link != nullptr) {
+    parent = *link;
+    if (comp_(key, KeyOf(parent))) {
+      link = &parent->left_;
+    } else if (!kUnique || comp_(KeyOf(parent), key)) {
+      link = &parent->right_;
     } else {
-      check_insert = RecursiveInsert(node->left_, key, value);
+      return {parent, nullptr};
+    }
+  }
+  return {parent, link};
+}
+
+// Hangs a detached node on link and retraces towards the root only while
+// subtree heights keep growing. One (single or double) rotation restores the
+// height, so retracing stops there.
+template <class Key, class Value, class Compare, class Allocator>
+void s21_AVLTree<Key, Value, Compare, Allocator>::LinkNode(Node *parent,
+                                                           Node **link,
+                                                           Node *node) {
+  node->parent_ = parent;
+  node->left_ = nullptr;
+  node->right_ = nullptr;
+  node->height_ = 0;
+  *link = node;
+  ++size_;
+
+  for (Node *ancestor = parent; ancestor != nullptr;
+       ancestor = ancestor->parent_) {
+    int old_height = ancestor->height_;
+    SetHeight(ancestor);
+    int balance = GetBalance(ancestor);
+    if (balance == 2 || balance == -2) {
+      Balance(ancestor);
+      break;
     }
-  } else if (key > node->key_) {
-    if (node->right_ == nullptr) {
-      node->right_ = new Node(key, value, node);
-      check_insert = true;
+    if (ancestor->height_ == old_height) break;
+  }
+}
+
+template <class Key, class Value, class Compare, class Allocator>
+void s21_AVLTree<Key, Value, Compare, Allocator>::EraseNode(Node *node) {
+  UnlinkNode(node);
+  DestroyNode(node);
+}
+
+// Takes node out of the tree without destroying it. A node with two
+// children is replaced by its in-order successor, which is relinked rather
+// than copied. Retracing starts where a node actually left the tree and
+// stops once a subtree keeps its old height.
+template <class Key, class Value, class Compare, class Allocator>
+void s21_AVLTree<Key, Value, Compare, Allocator>::UnlinkNode(Node *node) {
+  Node *retrace = node->parent_;
+  if (node->left_ != nullptr && node->right_ != nullptr) {
+    Node *next = GetMin(node->right_);
+    if (next->parent_ == node) {
+      retrace = next;
     } else {
-      check_insert = RecursiveInsert(node->right_, key, value);
+      retrace = next->parent_;
+      retrace->left_ = next->right_;
+      if (next->right_ != nullptr) next->right_->parent_ = retrace;
+      next->right_ = node->right_;
+      next->right_->parent_ = next;
     }
-  } else if (key == node->key_) {
-    return check_insert;  // инсерт не произошел потому что такой ключ был в
-                          // дереве
+    next->left_ = node->left_;
+    next->left_->parent_ = next;
+    next->height_ = node->height_;
+    ReplaceChild(node, next);
+  } else {
+    ReplaceChild(node, node->left_ != nullptr ? node->left_ : node->right_);
+  }
+  --size_;
+
+  while (retrace != nullptr) {
+    int old_height = retrace->height_;
+    SetHeight(retrace);
+    retrace = Balance(retrace);
+    if (retrace->height_ == old_height) break;
+    retrace = retrace->parent_;
   }
-  SetHeight(node);
-  Balance(node);
-  return check_insert;
 }
 
-template <typename Key, typename Value>
-typename s21_AVLTree<Key, Value>::Node *
-s21_AVLTree<Key, Value>::RecursiveDelete(s21_AVLTree::Node *node, Key key) {
-  if (node == nullptr) return nullptr;
-  if (key < node->key_) {
-    node->left_ = RecursiveDelete(node->left_, key);
-  } else if (key > node->key_) {
-    node->right_ = RecursiveDelete(node->right_, key);
+// Moves the nodes of other into this tree without copying or reallocating
+// them, so the allocators must compare equal. With kUnique, nodes whose key
+// is already here stay in other.
+template <class Key, class Value, class Compare, class Allocator>
+template <bool kUnique>
+void s21_AVLTree<Key, Value, Compare, Allocator>::MergeNodes(
+    s21_AVLTree &other) {
+  if (this == &other) return;
+  Iterator it = other.begin();
+  while (it.iter_node_ != nullptr) {
+    Node *node = it.iter_node_;
+    ++it;
+    auto [parent, link] = FindLink<kUnique>(KeyOf(node));
+    if (link == nullptr) continue;
+    other.UnlinkNode(node);
+    LinkNode(parent, link, node);
+  }
+}
+
+// Puts child (possibly null) where node hangs from its parent.
+template <class Key, class Value, class Compare, class Allocator>
+void s21_AVLTree<Key, Value, Compare, Allocator>::ReplaceChild(
+    Node *node, Node *child) {
+  Node *parent = node->parent_;
+  if (child != nullptr) child->parent_ = parent;
+  if (parent == nullptr) {
+    root_ = child;
+  } else if (parent->left_ == node) {
+    parent->left_ = child;
   } else {
-    if (node->left_ == nullptr || node->right_ == nullptr) {
-      Node *node_right = node->right_;
-      Node *node_left = node->left_;
-      Node *node_parent = node->parent_;
-      delete node;
-      if (node_left == nullptr) {
-        node = node_right;
-      } else {
-        node = node_left;
-      }
-      if (node != nullptr) node->parent_ = node_parent;
+    parent->right_ = child;
+  }
+}
+
+// Iterative lookup below node; K is Key or, with a transparent Compare, any
+// type the comparator accepts. For integers under std::less equivalence is
+// plain ==, and written that way the compiler picks the child with a
+// conditional move instead of a branch that random keys mispredict half the
+// time.
+template <class Key, class Value, class Compare, class Allocator>
+template <class K>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *
+s21_AVLTree<Key, Value, Compare, Allocator>::FindNode(
+    Node *node, const K &key) {
+  constexpr bool kPlainEquality =
+      std::is_integral_v<Key> && std::is_same_v<K, Key> &&
+      (std::is_same_v<Compare, std::less<Key>> ||
+       std::is_same_v<Compare, std::less<>>);
+  while (node != nullptr) {
+    if constexpr (kPlainEquality) {
+      if (KeyOf(node) == key) break;
     } else {
-      Node *min_in_right = GetMin(node->right_);
-      node->key_ = min_in_right->key_;
-      node->value_ = min_in_right->value_;
-      node->right_ = RecursiveDelete(node->right_, min_in_right->key_);
+      if (!comp_(key, KeyOf(node)) && !comp_(KeyOf(node), key)) break;
     }
-  }
-  if (node != nullptr) {
-    SetHeight(node);
-    Balance(node);
+    node = comp_(KeyOf(node), key) ? node->right_ : node->left_;
   }
   return node;
 }
 
-template <typename Key, typename Value>
-typename s21_AVLTree<Key, Value>::Node *s21_AVLTree<Key, Value>::RecursiveFind(
-    s21_AVLTree::Node *node, const Key &key) {
-  if (node == nullptr || node->key_ == key) return node;
-  if (key > node->key_) {
-    return RecursiveFind(node->right_, key);
-  } else {
-    return RecursiveFind(node->left_, key);
+// The first node whose key is not less than key, or null.
+template <class Key, class Value, class Compare, class Allocator>
+template <class K>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *
+s21_AVLTree<Key, Value, Compare, Allocator>::LowerBoundNode(const K &key) {
+  Node *bound = nullptr;
+  for (Node *node = root_; node != nullptr;) {
+    if (comp_(KeyOf(node), key)) {
+      node = node->right_;
+    } else {
+      bound = node;
+      node = node->left_;
+    }
   }
+  return bound;
+}
+
+// The first node whose key is greater than key, or null.
+template <class Key, class Value, class Compare, class Allocator>
+template <class K>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::Node *
+s21_AVLTree<Key, Value, Compare, Allocator>::UpperBoundNode(const K &key) {
+  Node *bound = nullptr;
+  for (Node *node = root_; node != nullptr;) {
+    if (comp_(key, KeyOf(node))) {
+      bound = node;
+      node = node->left_;
+    } else {
+      node = node->right_;
+    }
+  }
+  return bound;
+}
+
+// A null node stands for end().
+template <class Key, class Value, class Compare, class Allocator>
+typename s21_AVLTree<Key, Value, Compare, Allocator>::iterator
+s21_AVLTree<Key, Value, Compare, Allocator>::IteratorAt(Node *node) {
+  return node == nullptr ? end() : Iterator(node);
 }
 
 #endif  // S21_AVL_H
\ No newline at end of file
@@ -0,0 +1,174 @@
+#ifndef S21_POOL_ALLOCATOR_H
+#define S21_POOL_ALLOCATOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+// Fixed-size blocks carved out of large slabs. Freed blocks go to an intrusive
+// free list and are handed out again before any new slab is requested, so a
+// container with heavy push/pop churn stops calling malloc once it has warmed
+// up. The block size is fixed by the first type that allocates from the pool.
+// Not thread-safe: a pool is meant to be owned by a single container.
+class node_pool {
+ public:
+  node_pool() = default;
+  node_pool(const node_pool&) = delete;
+  node_pool& operator=(const node_pool&) = delete;
+  ~node_pool() {
+    for (void* slab : slabs_) {
+      ::operator delete(slab, std::align_val_t(block_align_));
+    }
+  }
+
+  // Tells whether blocks of this size and alignment are served by the pool.
+  bool accepts(size_t size, size_t align) {
+    if (block_size_ == 0) {
+      block_align_ = std::max(align, alignof(FreeBlock));
+      size_t padded = std::max(size, sizeof(FreeBlock));
+      block_size_ = (padded + block_align_ - 1) / block_align_ * block_align_;
+      requested_size_ = size;
+      requested_align_ = align;
+    }
+    return size == requested_size_ && align == requested_align_;
+  }
+
+  void* allocate() {
+    if (free_ == nullptr) {
+      Grow(next_slab_);
+      if (next_slab_ < kMaxSlab) next_slab_ *= 2;
+    }
+    FreeBlock* block = free_;
+    free_ = block->next;
+    --free_count_;
+    return block;
+  }
+
+  void deallocate(void* ptr) {
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+    block->next = free_;
+    free_ = block;
+    ++free_count_;
+  }
+
+  // Makes sure at least n blocks can be handed out without touching the heap.
+  void reserve(size_t n) {
+    if (n > free_count_) Grow(n - free_count_);
+  }
+
+  size_t free_count() { return free_count_; }
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  static constexpr size_t kFirstSlab = 32;
+  static constexpr size_t kMaxSlab = 4096;
+
+  std::vector<void*> slabs_;
+  FreeBlock* free_ = nullptr;
+  size_t free_count_ = 0;
+  size_t next_slab_ = kFirstSlab;
+  size_t block_size_ = 0;
+  size_t block_align_ = alignof(FreeBlock);
+  size_t requested_size_ = 0;
+  size_t requested_align_ = 0;
+
+  // Blocks are linked in address order, so consecutive allocations from a
+  // fresh slab are adjacent in memory.
+  void Grow(size_t blocks) {
+    char* slab = static_cast<char*>(
+        ::operator new(blocks * block_size_, std::align_val_t(block_align_)));
+    slabs_.push_back(slab);
+    for (size_t i = blocks; i != 0; --i) {
+      deallocate(slab + (i - 1) * block_size_);
+    }
+  }
+};
+
+// Allocator that serves single-object requests (list, Stack and tree nodes)
+// from a node_pool and forwards everything else to std::allocator. Copies and
+// rebinds share the pool; a copied container gets a fresh one, so pools are
+// never shared between containers behind the user's back.
+template <class T>
+class pool_allocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  pool_allocator() : pool_(std::make_shared<node_pool>()) {}
+  template <class U>
+  pool_allocator(const pool_allocator<U>& other) noexcept
+      : pool_(other.pool_) {}
+
+  T* allocate(size_t n) {
+    if (n == 1 && pool_->accepts(sizeof(T), alignof(T))) {
+      return static_cast<T*>(pool_->allocate());
+    }
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* ptr, size_t n) {
+    if (n == 1 && pool_->accepts(sizeof(T), alignof(T))) {
+      pool_->deallocate(ptr);
+    } else {
+      std::allocator<T>().deallocate(ptr, n);
+    }
+  }
+
+  // Pre-allocates room for n more objects of type T.
+  void reserve(size_t n) {
+    if (pool_->accepts(sizeof(T), alignof(T))) {
+      pool_->reserve(n);
+    }
+  }
+
+  pool_allocator select_on_container_copy_construction() const {
+    return pool_allocator();
+  }
+
+  template <class U>
+  bool operator==(const pool_allocator<U>& other) const {
+    return pool_ == other.pool_;
+  }
+
+  template <class U>
+  bool operator!=(const pool_allocator<U>& other) const {
+    return pool_ != other.pool_;
+  }
+
+ private:
+  template <class U>
+  friend class pool_allocator;
+
+  std::shared_ptr<node_pool> pool_;
+};
+
+template <class Alloc, class = void>
+struct has_reserve : std::false_type {};
+
+template <class Alloc>
+struct has_reserve<Alloc, std::void_t<decltype(std::declval<Alloc&>().reserve(
+                              std::declval<size_t>()))>> : std::true_type {};
+
+// Calls alloc.reserve(n) for allocators that support it and does nothing for
+// the others.
+template <class Alloc>
+void reserve_allocator(Alloc& alloc, size_t n) {
+  if constexpr (has_reserve<Alloc>::value) {
+    alloc.reserve(n);
+  }
+}
+
+}  // namespace s21
+
+#endif
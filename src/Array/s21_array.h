@@ -1,5 +1,10 @@
 #ifndef S21_ARRAY_H
 #define S21_ARRAY_H
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
 #include "../s21_container.h"
 
 namespace s21 {
@@ -40,27 +45,36 @@ struct array {
  private:
   size_type size_ = N;
   value_type data_[N];
+
+  static constexpr bool kTrivial = std::is_trivially_copyable_v<T>;
 };
 
 template <typename T, size_t N>
 array<T, N>::array(std::initializer_list<value_type> const &items) : array() {
-  for (size_type i = 0; i < items.size(); ++i) {
-    data_[i] = *(items.begin() + i);
+  size_type count = items.size() < N ? items.size() : N;
+  if constexpr (kTrivial) {
+    std::memcpy(data_, items.begin(), count * sizeof(T));
+  } else {
+    std::copy_n(items.begin(), count, data_);
   }
 }
 
 template <typename T, size_t N>
 array<T, N>::array(const array &a) {
-  for (size_type i = 0; i < size_; ++i) {
-    data_[i] = a.data_[i];
+  if constexpr (kTrivial) {
+    std::memcpy(data_, a.data_, sizeof(data_));
+  } else {
+    std::copy(a.data_, a.data_ + N, data_);
   }
 }
 
 template <class T, size_t N>
 array<T, N> &array<T, N>::operator=(array &&a) {
   if (this != &a) {
-    for (size_type i = 0; i < a.size(); ++i) {
-      data_[i] = std::move(a.data_[i]);
+    if constexpr (kTrivial) {
+      std::memcpy(data_, a.data_, sizeof(data_));
+    } else {
+      std::move(a.data_, a.data_ + N, data_);
     }
   }
   return *this;
@@ -87,18 +101,34 @@ typename s21::array<T, N>::iterator s21::array<T, N>::data() {
 
 template <typename T, size_t N>
 void array<T, N>::swap(array &other) {
-  value_type tmp;
-  for (size_type i = 0; i < size_; ++i) {
-    tmp = other.data_[i];
-    other.data_[i] = data_[i];
-    data_[i] = tmp;
+  if constexpr (kTrivial) {
+    // swap through a small stack buffer, one cache-friendly chunk at a time
+    constexpr size_type kChunk = 256;
+    unsigned char tmp[kChunk];
+    unsigned char *a = reinterpret_cast<unsigned char *>(data_);
+    unsigned char *b = reinterpret_cast<unsigned char *>(other.data_);
+    for (size_type left = sizeof(data_); left != 0;) {
+      size_type step = left < kChunk ? left : kChunk;
+      std::memcpy(tmp, a, step);
+      std::memcpy(a, b, step);
+      std::memcpy(b, tmp, step);
+      a += step;
+      b += step;
+      left -= step;
+    }
+  } else {
+    std::swap_ranges(data_, data_ + N, other.data_);
   }
 }
 
 template <class T, size_t N>
 void array<T, N>::fill(const_reference value) {
-  for (size_type i = 0; i < N; ++i) {
-    data_[i] = value;
+  if constexpr (kTrivial && sizeof(T) == 1) {
+    unsigned char byte;
+    std::memcpy(&byte, &value, 1);
+    std::memset(data_, byte, N);
+  } else {
+    std::fill_n(data_, N, value);
   }
 }
 }  // namespace s21
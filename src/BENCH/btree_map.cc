@@ -0,0 +1,80 @@
+// Insert, lookup and in-order iteration throughput of s21::btree_map against
+// the AVL-backed s21::map, over shuffled int keys at growing sizes. Small
+// maps are rebuilt and rescanned until each phase has done at least a
+// million operations. Sizes run from 1K up to the key count given as the
+// first argument (10M by default).
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../Map/s21_btree_map.h"
+#include "../Map/s21_map.h"
+
+namespace {
+constexpr size_t kMinOperations = 1000000;
+
+double Rate(double operations, std::chrono::steady_clock::time_point start) {
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return operations / elapsed.count() / 1e6;
+}
+
+// Prints millions of operations per second for each phase.
+template <class Map>
+void Report(const char* name, const std::vector<int>& keys,
+            const std::vector<int>& lookups) {
+  size_t rounds = std::max<size_t>(1, kMinOperations / keys.size());
+  Map map;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t round = 0; round < rounds; ++round) {
+    map.clear();
+    for (int key : keys) map.insert(key, key);
+  }
+  double insert = Rate(static_cast<double>(rounds) * keys.size(), start);
+
+  start = std::chrono::steady_clock::now();
+  size_t found = 0;
+  for (size_t round = 0; round < rounds; ++round) {
+    for (int key : lookups) found += map.find(key) != map.end();
+  }
+  double lookup = Rate(static_cast<double>(rounds) * keys.size(), start);
+
+  start = std::chrono::steady_clock::now();
+  long long sum = 0;
+  for (size_t round = 0; round < rounds; ++round) {
+    for (auto it = map.begin(); it != map.end(); ++it) sum += (*it).second;
+  }
+  double iterate = Rate(static_cast<double>(rounds) * keys.size(), start);
+
+  std::printf("%-8zu %-16s %10.2f %10.2f %10.2f\n", keys.size(), name, insert,
+              lookup, iterate);
+  long long expected = static_cast<long long>(rounds) *
+                       (static_cast<long long>(keys.size()) - 1) *
+                       static_cast<long long>(keys.size()) / 2;
+  if (found != rounds * keys.size() || sum != expected) {
+    std::printf("  mismatch!\n");
+  }
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t limit = argc > 1 ? std::atol(argv[1]) : 10000000;
+  std::printf("M ops/s\n%-8s %-16s %10s %10s %10s\n", "keys", "", "insert",
+              "find", "iterate");
+  for (size_t count = 1000; count <= limit; count *= 10) {
+    std::vector<int> keys(count);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::mt19937 random(42);
+    std::shuffle(keys.begin(), keys.end(), random);
+    std::vector<int> lookups(keys);
+    std::shuffle(lookups.begin(), lookups.end(), random);
+
+    Report<s21::map<int, int>>("s21::map", keys, lookups);
+    Report<s21::btree_map<int, int>>("s21::btree_map", keys, lookups);
+  }
+  return 0;
+}
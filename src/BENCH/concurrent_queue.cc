@@ -0,0 +1,83 @@
+// Throughput of the concurrent queues against a mutex-wrapped s21::queue
+// with 1..N producer and consumer threads on each side.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../Queue/s21_concurrent_queue.h"
+#include "../Queue/s21_queue.h"
+
+namespace {
+constexpr int kItemsPerProducer = 200000;
+
+class locked_queue {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+  }
+  bool try_pop(int& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<int> queue_;
+};
+
+// Returns millions of push/pop pairs per second.
+template <class Queue>
+double Measure(Queue& queue, int threads) {
+  long long total = static_cast<long long>(threads) * kItemsPerProducer;
+  std::atomic<long long> consumed{0};
+  std::vector<std::thread> workers;
+  auto start = std::chrono::steady_clock::now();
+  for (int p = 0; p < threads; ++p) {
+    workers.emplace_back([&queue] {
+      for (int i = 0; i < kItemsPerProducer; ++i) queue.push(i);
+    });
+  }
+  for (int c = 0; c < threads; ++c) {
+    workers.emplace_back([&queue, &consumed, total] {
+      int value;
+      while (consumed.load(std::memory_order_relaxed) < total) {
+        if (queue.try_pop(value)) {
+          consumed.fetch_add(1, std::memory_order_relaxed);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& worker : workers) worker.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return static_cast<double>(total) / elapsed.count() / 1e6;
+}
+}  // namespace
+
+int main() {
+  int max_threads =
+      std::max(2, static_cast<int>(std::thread::hardware_concurrency()) / 2);
+  std::printf("%-8s %14s %14s %14s\n", "threads", "mutex queue", "bounded",
+              "unbounded");
+  for (int threads = 1; threads <= max_threads; ++threads) {
+    locked_queue locked;
+    s21::concurrent_queue<int> bounded(4096);
+    s21::unbounded_concurrent_queue<int> unbounded;
+    double locked_rate = Measure(locked, threads);
+    double bounded_rate = Measure(bounded, threads);
+    double unbounded_rate = Measure(unbounded, threads);
+    std::printf("%-8d %10.2f M/s %10.2f M/s %10.2f M/s\n", threads,
+                locked_rate, bounded_rate, unbounded_rate);
+  }
+  return 0;
+}
@@ -0,0 +1,71 @@
+// Push/pop pairs per second on concurrent_stack against a mutex-wrapped
+// s21::Stack, with 1..N threads hammering the same stack.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../Stack/s21_concurrent_stack.h"
+#include "../Stack/s21_stack.h"
+
+namespace {
+constexpr int kPairsPerThread = 500000;
+
+class locked_stack {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+  bool try_pop(int& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    value = stack_.top();
+    stack_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Stack<int> stack_;
+};
+
+// Returns millions of push/pop pairs per second.
+template <class Stack>
+double Measure(Stack& stack, int threads) {
+  std::vector<std::thread> workers;
+  auto start = std::chrono::steady_clock::now();
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&stack] {
+      int value;
+      for (int i = 0; i < kPairsPerThread; ++i) {
+        stack.push(i);
+        stack.try_pop(value);
+      }
+    });
+  }
+  for (auto& worker : workers) worker.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return static_cast<double>(threads) * kPairsPerThread / elapsed.count() /
+         1e6;
+}
+}  // namespace
+
+int main() {
+  int max_threads =
+      std::max(2, static_cast<int>(std::thread::hardware_concurrency()));
+  std::printf("%-8s %14s %18s\n", "threads", "mutex Stack",
+              "concurrent_stack");
+  for (int threads = 1; threads <= max_threads; ++threads) {
+    locked_stack locked;
+    s21::concurrent_stack<int> lock_free;
+    double locked_rate = Measure(locked, threads);
+    double lock_free_rate = Measure(lock_free, threads);
+    std::printf("%-8d %10.2f M/s %14.2f M/s\n", threads, locked_rate,
+                lock_free_rate);
+  }
+  return 0;
+}
@@ -0,0 +1,86 @@
+// Traversal and insertion throughput of s21::list and s21::unrolled_list,
+// with std::list as a reference point.
+#include <chrono>
+#include <cstdio>
+#include <list>
+
+#include "../List/s21_list.h"
+#include "../List/s21_unrolled_list.h"
+
+namespace {
+// small enough to stay in cache, so the loop itself is what is measured
+constexpr int kElements = 10000;
+constexpr int kRounds = 2000;
+constexpr int kLargeElements = 1000000;
+
+double Rate(double operations, std::chrono::steady_clock::time_point start) {
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return operations / elapsed.count() / 1e6;
+}
+
+// Millions of elements visited per second, forward then backward.
+template <class List>
+double Traverse(int elements, int rounds, long long& checksum) {
+  List list;
+  for (int i = 0; i < elements; ++i) list.push_back(i);
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; ++round) {
+    for (auto it = list.begin(); it != list.end(); ++it) checksum += *it;
+    auto it = list.end();
+    do {
+      --it;
+      checksum -= *it;
+    } while (it != list.begin());
+  }
+  return Rate(2.0 * rounds * elements, start);
+}
+
+template <class List>
+double PushBack() {
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < 5; ++round) {
+    List list;
+    for (int i = 0; i < kLargeElements; ++i) list.push_back(i);
+  }
+  return Rate(5.0 * kLargeElements, start);
+}
+
+// Inserts in front of every other element of a growing list.
+template <class List>
+double InsertMiddle() {
+  List list;
+  for (int i = 0; i < kElements; ++i) list.push_back(i);
+  auto start = std::chrono::steady_clock::now();
+  int inserted = 0;
+  for (int round = 0; round < 10; ++round) {
+    for (auto it = list.begin(); it != list.end(); ++it) {
+      it = list.insert(it, round);
+      ++it;
+      ++inserted;
+      if (++it == list.end()) break;
+    }
+  }
+  return Rate(inserted, start);
+}
+
+template <class List>
+void Report(const char* name, long long& checksum) {
+  std::printf("%-20s %10.1f %10.1f %10.1f %10.1f\n", name,
+              Traverse<List>(kElements, kRounds, checksum),
+              Traverse<List>(kLargeElements, 20, checksum), PushBack<List>(),
+              InsertMiddle<List>());
+}
+}  // namespace
+
+int main() {
+  long long checksum = 0;
+  std::printf("M elements/s         %10s %10s %10s %10s\n", "traverse",
+              "trav. 1M", "push_back", "insert");
+
+  Report<s21::list<int>>("s21::list", checksum);
+  Report<s21::unrolled_list<int, 16>>("unrolled_list<16>", checksum);
+  Report<s21::unrolled_list<int, 64>>("unrolled_list<64>", checksum);
+  Report<std::list<int>>("std::list", checksum);
+  return checksum == 0 ? 0 : 1;
+}
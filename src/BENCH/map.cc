@@ -0,0 +1,103 @@
+// Insert, lookup, in-order iteration and erase throughput of s21::map
+// against std::map over shuffled keys, first with int values and then with
+// 256-byte values. Ascending inserts are timed separately, since they rotate
+// on most inserts. The key count defaults to 10M (a tenth of that for the
+// large values) and can be passed as the first argument.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../Map/s21_map.h"
+
+namespace {
+struct Large {
+  explicit Large(int v = 0) : value(v) {}
+  long long value;
+  char padding[248] = {};
+};
+
+long long ValueOf(int value) { return value; }
+long long ValueOf(const Large& value) { return value.value; }
+
+double Rate(double operations, std::chrono::steady_clock::time_point start) {
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return operations / elapsed.count() / 1e6;
+}
+
+// Prints millions of operations per second for each phase.
+template <class Map>
+void Report(const char* name, const std::vector<int>& keys,
+            const std::vector<int>& erase_order) {
+  using mapped_type = typename Map::mapped_type;
+  double ascending;
+  {
+    Map map;
+    auto start = std::chrono::steady_clock::now();
+    for (int key = 0; key < static_cast<int>(keys.size()); ++key) {
+      map.insert({key, mapped_type(key)});
+    }
+    ascending = Rate(keys.size(), start);
+  }
+
+  Map map;
+  auto start = std::chrono::steady_clock::now();
+  for (int key : keys) map.insert({key, mapped_type(key)});
+  double insert = Rate(keys.size(), start);
+
+  start = std::chrono::steady_clock::now();
+  size_t found = 0;
+  for (int key : erase_order) found += map.find(key) != map.end();
+  double lookup = Rate(keys.size(), start);
+
+  start = std::chrono::steady_clock::now();
+  long long sum = 0;
+  for (int round = 0; round < 5; ++round) {
+    for (auto it = map.begin(); it != map.end(); ++it) {
+      sum += ValueOf((*it).second);
+    }
+  }
+  double iterate = Rate(5.0 * keys.size(), start);
+
+  // s21::map has no erase by key
+  start = std::chrono::steady_clock::now();
+  for (int key : erase_order) map.erase(map.find(key));
+  double erase = Rate(keys.size(), start);
+
+  std::printf("%-10s %10.2f %10.2f %10.2f %10.2f %10.2f\n", name, ascending,
+              insert, lookup, iterate, erase);
+  long long expected = 5 * (static_cast<long long>(keys.size()) - 1) *
+                       static_cast<long long>(keys.size()) / 2;
+  if (found != keys.size() || sum != expected || !map.empty()) {
+    std::printf("  mismatch!\n");
+  }
+}
+
+template <class T>
+void Table(int count) {
+  std::vector<int> keys(count);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::mt19937 random(42);
+  std::shuffle(keys.begin(), keys.end(), random);
+  std::vector<int> erase_order(keys);
+  std::shuffle(erase_order.begin(), erase_order.end(), random);
+
+  std::printf("%d keys, %zu-byte values, M ops/s\n", count, sizeof(T));
+  std::printf("%-10s %10s %10s %10s %10s %10s\n", "", "ascending", "insert",
+              "find", "iterate", "erase");
+  Report<s21::map<int, T>>("s21::map", keys, erase_order);
+  Report<std::map<int, T>>("std::map", keys, erase_order);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 10000000;
+  Table<int>(count);
+  Table<Large>(count / 10);
+  return 0;
+}
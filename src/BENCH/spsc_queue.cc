@@ -0,0 +1,103 @@
+// One producer, one consumer: spsc_queue, element-wise and in batches,
+// against a mutex-wrapped s21::queue and the MPMC concurrent_queue.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../Queue/s21_concurrent_queue.h"
+#include "../Queue/s21_queue.h"
+#include "../Queue/s21_spsc_queue.h"
+
+namespace {
+constexpr int kItems = 2000000;
+constexpr int kBatch = 32;
+
+class locked_queue {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+  }
+  bool try_pop(int& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<int> queue_;
+};
+
+template <class Producer, class Consumer>
+double Measure(Producer produce, Consumer consume) {
+  auto start = std::chrono::steady_clock::now();
+  std::thread consumer(consume);
+  produce();
+  consumer.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return kItems / elapsed.count() / 1e6;
+}
+
+// Returns millions of push/pop pairs per second.
+template <class Queue>
+double Single(Queue& queue) {
+  return Measure(
+      [&queue] {
+        for (int i = 0; i < kItems; ++i) queue.push(i);
+      },
+      [&queue] {
+        int value;
+        for (int i = 0; i < kItems;) {
+          if (queue.try_pop(value)) {
+            ++i;
+          } else {
+            std::this_thread::yield();
+          }
+        }
+      });
+}
+
+template <class Queue>
+double Batched(Queue& queue) {
+  return Measure(
+      [&queue] {
+        std::vector<int> batch(kBatch);
+        for (int i = 0; i < kItems;) {
+          int n = std::min(kBatch, kItems - i);
+          for (int j = 0; j < n; ++j) batch[j] = i + j;
+          size_t pushed = queue.push_bulk(batch.begin(), batch.begin() + n);
+          if (pushed == 0) std::this_thread::yield();
+          i += static_cast<int>(pushed);
+        }
+      },
+      [&queue] {
+        std::vector<int> batch(kBatch);
+        for (int i = 0; i < kItems;) {
+          size_t popped = queue.pop_bulk(batch.begin(), kBatch);
+          if (popped == 0) std::this_thread::yield();
+          i += static_cast<int>(popped);
+        }
+      });
+}
+}  // namespace
+
+int main() {
+  locked_queue locked;
+  s21::concurrent_queue<int> mpmc(4096);
+  auto spsc = std::make_unique<s21::spsc_queue<int, 4096>>();
+  std::printf("%-24s %10.2f M/s\n", "mutex queue", Single(locked));
+  std::printf("%-24s %10.2f M/s\n", "concurrent_queue", Single(mpmc));
+  std::printf("%-24s %10.2f M/s\n", "spsc_queue", Single(*spsc));
+  std::printf("%-24s %10.2f M/s\n", "concurrent_queue bulk", Batched(mpmc));
+  std::printf("%-24s %10.2f M/s\n", "spsc_queue bulk", Batched(*spsc));
+  return 0;
+}
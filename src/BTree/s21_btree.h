@@ -0,0 +1,811 @@
+#ifndef S21_BTREE_H
+#define S21_BTREE_H
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// B-tree counterpart of s21_AVLTree for large maps and sets of small keys.
+// Values are laid out as in s21_AVLTree (the key itself for sets,
+// std::pair<const Key, T> for maps), but each node keeps up to kMaxValues of
+// them side by side, so one node spans about NodeBytes (four cache lines by
+// default) and a lookup scans a few contiguous arrays instead of chasing one
+// pointer per level. Internal nodes also hold kMaxValues + 1 children.
+// Inserting or erasing moves values between nodes, so unlike s21_AVLTree it
+// invalidates all iterators.
+template <class Key, class Value, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Value>, size_t NodeBytes = 256>
+class s21_BTree {
+ protected:
+  struct Node;
+  struct InternalNode;
+
+ public:
+  class Iterator;
+  class ConstIterator;
+
+  using key_type = Key;
+  using value_type = Value;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using size_type = size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+
+  // The node header (parent, position, count and leaf flag) fits in three
+  // pointers; at least three values are needed for a split to leave both
+  // halves non-empty.
+  static constexpr int kMaxValues =
+      NodeBytes > 3 * sizeof(void *) + 3 * sizeof(Value)
+          ? (NodeBytes - 3 * sizeof(void *)) / sizeof(Value)
+          : 3;
+  static constexpr int kMinValues = (kMaxValues - 1) / 2;
+
+  // A position inside a node. end() is one past the last value of the
+  // rightmost leaf, so it can be decremented like any other position.
+  class Iterator {
+   public:
+    Iterator() : node_(nullptr), position_(0){};
+    Iterator(Node *node, int position) : node_(node), position_(position){};
+    iterator &operator++();
+    iterator operator++(int);
+    iterator &operator--();
+    iterator operator--(int);
+    reference operator*() const { return node_->slots_[position_].value; };
+    pointer operator->() const { return &operator*(); };
+    bool operator==(const iterator &it) const {
+      return node_ == it.node_ && position_ == it.position_;
+    };
+    bool operator!=(const iterator &it) const { return !operator==(it); };
+    friend class s21_BTree;
+
+   protected:
+    Node *node_;
+    int position_;
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    ConstIterator() : Iterator(){};
+    ConstIterator(const Iterator &it) : Iterator(it){};
+    const_reference operator*() const { return Iterator::operator*(); };
+    const value_type *operator->() const { return &operator*(); };
+  };
+
+  s21_BTree();
+  explicit s21_BTree(const Allocator &alloc);
+  explicit s21_BTree(const Compare &comp, const Allocator &alloc = Allocator());
+  s21_BTree(const s21_BTree &other);
+  s21_BTree(s21_BTree &&other) noexcept;
+  ~s21_BTree();
+  s21_BTree &operator=(s21_BTree &&other) noexcept(kNothrowMoveAssign);
+  s21_BTree &operator=(const s21_BTree &other);
+  allocator_type get_allocator() const { return alloc_; }
+  key_compare key_comp() const { return comp_; }
+
+  iterator begin() const;
+  iterator end() const;
+  const_iterator cbegin() const { return begin(); };
+  const_iterator cend() const { return end(); };
+
+  bool empty() const { return size_ == 0; };
+  size_type size() const { return size_; };
+  size_type max_size() const;
+
+  void clear();
+  void erase(iterator pos);
+  void swap(s21_BTree &other);
+
+  iterator find(const Key &key) { return Find(key); };
+  const_iterator find(const Key &key) const { return Find(key); };
+  bool contains(const Key &key) const { return Find(key) != end(); };
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K &key) {
+    return Find(key);
+  };
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator find(const K &key) const {
+    return Find(key);
+  };
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K &key) const {
+    return Find(key) != end();
+  };
+
+ protected:
+  // Values are constructed in place only in the first count_ slots.
+  union Slot {
+    Slot(){};
+    ~Slot(){};
+    Value value;
+  };
+
+  struct Node {
+    explicit Node(bool leaf) : leaf_(leaf){};
+    Node *parent_ = nullptr;
+    int position_ = 0;  // index of this node among its parent's children
+    int count_ = 0;
+    bool leaf_;
+    Slot slots_[kMaxValues];
+  };
+
+  struct InternalNode : Node {
+    InternalNode() : Node(false){};
+    Node *children_[kMaxValues + 1] = {};
+  };
+
+  using value_traits = std::allocator_traits<Allocator>;
+  using leaf_allocator = typename value_traits::template rebind_alloc<Node>;
+  using internal_allocator =
+      typename value_traits::template rebind_alloc<InternalNode>;
+  // Move assignment only throws when it has to move values into new nodes.
+  static constexpr bool kNothrowMoveAssign =
+      value_traits::propagate_on_container_move_assignment::value ||
+      value_traits::is_always_equal::value;
+
+  Allocator alloc_;
+  Compare comp_;
+  Node *root_;
+  Node *rightmost_;  // the leaf end() points into
+  size_type size_;
+
+  static const Key &KeyOf(const Value &value);
+  static Node *&Child(Node *node, int index) {
+    return static_cast<InternalNode *>(node)->children_[index];
+  };
+  static void SetChild(Node *node, int index, Node *child);
+  static Node *RightmostLeaf(Node *node);
+
+  template <class K>
+  int LowerBound(const Node *node, const K &key) const;
+  template <class K>
+  iterator Find(const K &key) const;
+  template <typename... Args>
+  std::pair<iterator, bool> InsertUnique(const Key &key, Args &&...args);
+  void EraseAt(Node *node, int position);
+
+  Node *CreateNode(bool leaf);
+  void DestroyNode(Node *node);
+  void FreeTree(Node *node);
+  template <bool kMove>
+  Node *CopyTree(Node *other, Node *parent, int position);
+  void MoveValues(Node *dst, int to, Node *src, int from, int count);
+  void MoveChildren(Node *dst, int to, Node *src, int from, int count);
+  void Split(Node *node);
+  void Rebalance(Node *node);
+  void RotateLeft(Node *parent, int position);
+  void RotateRight(Node *parent, int position);
+  void Merge(Node *parent, int position);
+};
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::s21_BTree()
+    : s21_BTree(Compare()) {}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::s21_BTree(
+    const Allocator &alloc)
+    : s21_BTree(Compare(), alloc) {}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::s21_BTree(
+    const Compare &comp, const Allocator &alloc)
+    : alloc_(alloc),
+      comp_(comp),
+      root_(nullptr),
+      rightmost_(nullptr),
+      size_(0) {}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::s21_BTree(
+    const s21_BTree &other)
+    : alloc_(value_traits::select_on_container_copy_construction(
+          other.alloc_)),
+      comp_(other.comp_),
+      root_(nullptr),
+      rightmost_(nullptr),
+      size_(0) {
+  if (other.root_ != nullptr) root_ = CopyTree<false>(other.root_, nullptr, 0);
+  rightmost_ = RightmostLeaf(root_);
+  size_ = other.size_;
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::s21_BTree(
+    s21_BTree &&other) noexcept
+    : alloc_(other.alloc_),
+      comp_(other.comp_),
+      root_(nullptr),
+      rightmost_(nullptr),
+      size_(0) {
+  std::swap(root_, other.root_);
+  std::swap(rightmost_, other.rightmost_);
+  std::swap(size_, other.size_);
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::~s21_BTree() {
+  clear();
+}
+
+// Nodes change hands when the allocator follows them (or both allocators are
+// interchangeable); otherwise the values are moved into fresh nodes.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes> &
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::operator=(
+    s21_BTree &&other) noexcept(kNothrowMoveAssign) {
+  if (this == &other) return *this;
+  clear();
+  comp_ = other.comp_;
+  if constexpr (value_traits::propagate_on_container_move_assignment::value) {
+    alloc_ = other.alloc_;
+  }
+  if (alloc_ == other.alloc_) {
+    std::swap(root_, other.root_);
+    std::swap(rightmost_, other.rightmost_);
+    std::swap(size_, other.size_);
+  } else {
+    if (other.root_ != nullptr) {
+      root_ = CopyTree<true>(other.root_, nullptr, 0);
+    }
+    rightmost_ = RightmostLeaf(root_);
+    size_ = other.size_;
+    other.clear();
+  }
+  return *this;
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes> &
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::operator=(
+    const s21_BTree &other) {
+  if (this == &other) return *this;
+  clear();
+  comp_ = other.comp_;
+  if constexpr (value_traits::propagate_on_container_copy_assignment::value) {
+    alloc_ = other.alloc_;
+  }
+  if (other.root_ != nullptr) root_ = CopyTree<false>(other.root_, nullptr, 0);
+  rightmost_ = RightmostLeaf(root_);
+  size_ = other.size_;
+  return *this;
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+typename s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::iterator
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::begin() const {
+  Node *node = root_;
+  if (node == nullptr) return Iterator();
+  while (!node->leaf_) node = Child(node, 0);
+  return Iterator(node, 0);
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+typename s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::iterator
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::end() const {
+  if (rightmost_ == nullptr) return Iterator();
+  return Iterator(rightmost_, rightmost_->count_);
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+typename s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::size_type
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(Value);
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::clear() {
+  FreeTree(root_);
+  root_ = nullptr;
+  rightmost_ = nullptr;
+  size_ = 0;
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::erase(
+    iterator pos) {
+  if (pos.node_ == nullptr || pos.position_ >= pos.node_->count_) return;
+  EraseAt(pos.node_, pos.position_);
+}
+
+// Allocators are exchanged only when they propagate on swap; otherwise they
+// must compare equal.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::swap(
+    s21_BTree &other) {
+  if constexpr (value_traits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+  std::swap(comp_, other.comp_);
+  std::swap(root_, other.root_);
+  std::swap(rightmost_, other.rightmost_);
+  std::swap(size_, other.size_);
+}
+
+// ITERATOR
+
+// In-order successor: the first value of the next subtree below an internal
+// node, the next slot in a leaf, or the separator of the nearest ancestor
+// entered from the left once a leaf runs out.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+typename s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::iterator &
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::Iterator::operator++() {
+  if (node_ == nullptr) return *this;
+  if (!node_->leaf_) {
+    node_ = Child(node_, position_ + 1);
+    while (!node_->leaf_) node_ = Child(node_, 0);
+    position_ = 0;
+    return *this;
+  }
+  if (++position_ < node_->count_) return *this;
+
+  Node *node = node_;
+  int position = position_;
+  while (node->parent_ != nullptr && position == node->count_) {
+    position = node->position_;
+    node = node->parent_;
+  }
+  // past the last value we stay at the end of the rightmost leaf
+  if (position < node->count_) {
+    node_ = node;
+    position_ = position;
+  }
+  return *this;
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+typename s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::iterator
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::Iterator::operator++(
+    int) {
+  Iterator temp = *this;
+  operator++();
+  return temp;
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+typename s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::iterator &
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::Iterator::operator--() {
+  if (node_ == nullptr) return *this;
+  if (!node_->leaf_) {
+    node_ = Child(node_, position_);
+    while (!node_->leaf_) node_ = Child(node_, node_->count_);
+    position_ = node_->count_ - 1;
+    return *this;
+  }
+  if (position_ > 0) {
+    --position_;
+    return *this;
+  }
+
+  Node *node = node_;
+  while (node->parent_ != nullptr && node->position_ == 0) {
+    node = node->parent_;
+  }
+  if (node->parent_ != nullptr) {
+    node_ = node->parent_;
+    position_ = node->position_ - 1;
+  }
+  return *this;
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+typename s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::iterator
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::Iterator::operator--(
+    int) {
+  Iterator temp = *this;
+  operator--();
+  return temp;
+}
+
+// LOOKUP
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+const Key &s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::KeyOf(
+    const Value &value) {
+  if constexpr (std::is_same_v<Key, Value>) {
+    return value;
+  } else {
+    return value.first;
+  }
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::SetChild(
+    Node *node, int index, Node *child) {
+  Child(node, index) = child;
+  child->parent_ = node;
+  child->position_ = index;
+}
+
+// Walked only when a whole tree is copied in; inserts and erases keep
+// rightmost_ up to date.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+typename s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::Node *
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::RightmostLeaf(
+    Node *node) {
+  if (node == nullptr) return nullptr;
+  while (!node->leaf_) node = Child(node, node->count_);
+  return node;
+}
+
+// Index of the first value in node that is not less than key. The search
+// range only shrinks from the top, and each step picks its new base with a
+// conditional move, so random keys do not pay for mispredicted branches.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+template <class K>
+int s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::LowerBound(
+    const Node *node, const K &key) const {
+  if (node->count_ == 0) return 0;
+  const Slot *base = node->slots_;
+  int count = node->count_;
+  while (count > 1) {
+    int half = count / 2;
+    base += half * comp_(KeyOf(base[half - 1].value), key);
+    count -= half;
+  }
+  return base - node->slots_ + comp_(KeyOf(base->value), key);
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+template <class K>
+typename s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::iterator
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::Find(const K &key) const {
+  Node *node = root_;
+  while (node != nullptr) {
+    int position = LowerBound(node, key);
+    if (position < node->count_ &&
+        !comp_(key, KeyOf(node->slots_[position].value))) {
+      return Iterator(node, position);
+    }
+    if (node->leaf_) break;
+    node = Child(node, position);
+  }
+  return end();
+}
+
+// INSERT AND ERASE
+
+// Values only enter the tree at a leaf. A full leaf is split first (which
+// may split its ancestors), and the new value goes to whichever half its
+// key falls into. The value is built from args only when the key is new.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+template <typename... Args>
+std::pair<typename s21_BTree<Key, Value, Compare, Allocator,
+                             NodeBytes>::iterator,
+          bool>
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::InsertUnique(
+    const Key &key, Args &&...args) {
+  if (root_ == nullptr) root_ = rightmost_ = CreateNode(true);
+  Node *node = root_;
+  int position;
+  while (true) {
+    position = LowerBound(node, key);
+    if (position < node->count_ &&
+        !comp_(key, KeyOf(node->slots_[position].value))) {
+      return {Iterator(node, position), false};
+    }
+    if (node->leaf_) break;
+    node = Child(node, position);
+  }
+
+  if (node->count_ == kMaxValues) {
+    Split(node);
+    if (position > kMaxValues / 2) {
+      position -= kMaxValues / 2 + 1;
+      node = Child(node->parent_, node->position_ + 1);
+    }
+  }
+  MoveValues(node, position + 1, node, position, node->count_ - position);
+  try {
+    value_traits::construct(alloc_, &node->slots_[position].value,
+                            std::forward<Args>(args)...);
+  } catch (...) {
+    MoveValues(node, position, node, position + 1, node->count_ - position);
+    throw;
+  }
+  ++node->count_;
+  ++size_;
+  return {Iterator(node, position), true};
+}
+
+// A value in an internal node is replaced by its in-order predecessor, the
+// last value of a leaf, so the actual removal always happens in a leaf.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::EraseAt(
+    Node *node, int position) {
+  value_traits::destroy(alloc_, &node->slots_[position].value);
+  if (!node->leaf_) {
+    Node *leaf = Child(node, position);
+    while (!leaf->leaf_) leaf = Child(leaf, leaf->count_);
+    MoveValues(node, position, leaf, leaf->count_ - 1, 1);
+    node = leaf;
+    position = leaf->count_ - 1;
+  }
+  MoveValues(node, position, node, position + 1,
+             node->count_ - position - 1);
+  --node->count_;
+  --size_;
+  Rebalance(node);
+}
+
+// Moves count values between slots (possibly overlapping ranges of one
+// node). Each value is move-constructed into its new slot and the old one is
+// destroyed, since map values have a const key and cannot be assigned.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::MoveValues(
+    Node *dst, int to, Node *src, int from, int count) {
+  auto move = [&](int i) {
+    value_traits::construct(alloc_, &dst->slots_[to + i].value,
+                            std::move(src->slots_[from + i].value));
+    value_traits::destroy(alloc_, &src->slots_[from + i].value);
+  };
+  if (dst == src && to > from) {
+    for (int i = count - 1; i >= 0; --i) move(i);
+  } else {
+    for (int i = 0; i < count; ++i) move(i);
+  }
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::MoveChildren(
+    Node *dst, int to, Node *src, int from, int count) {
+  if (dst == src && to > from) {
+    for (int i = count - 1; i >= 0; --i) {
+      SetChild(dst, to + i, Child(src, from + i));
+    }
+  } else {
+    for (int i = 0; i < count; ++i) SetChild(dst, to + i, Child(src, from + i));
+  }
+}
+
+// Moves the upper half of a full node into a new right sibling and its
+// middle value up into the parent, splitting a full parent first and
+// growing a new root above the old one.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::Split(
+    Node *node) {
+  if (node->parent_ == nullptr) {
+    Node *root = CreateNode(false);
+    SetChild(root, 0, node);
+    root_ = root;
+  } else if (node->parent_->count_ == kMaxValues) {
+    Split(node->parent_);
+  }
+  Node *parent = node->parent_;
+  int position = node->position_;
+  constexpr int kMiddle = kMaxValues / 2;
+
+  Node *sibling = CreateNode(node->leaf_);
+  sibling->count_ = node->count_ - kMiddle - 1;
+  MoveValues(sibling, 0, node, kMiddle + 1, sibling->count_);
+  if (!node->leaf_) {
+    MoveChildren(sibling, 0, node, kMiddle + 1, sibling->count_ + 1);
+  }
+
+  MoveValues(parent, position + 1, parent, position,
+             parent->count_ - position);
+  MoveChildren(parent, position + 2, parent, position + 1,
+               parent->count_ - position);
+  MoveValues(parent, position, node, kMiddle, 1);
+  SetChild(parent, position + 1, sibling);
+  ++parent->count_;
+  node->count_ = kMiddle;
+  if (node == rightmost_) rightmost_ = sibling;
+}
+
+// Refills a node that fell below kMinValues by borrowing through the parent
+// from a sibling that can spare a value, or else merges it with a sibling,
+// which takes a value from the parent and may leave that short in turn. An
+// emptied root is replaced by its only child.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::Rebalance(
+    Node *node) {
+  while (node != root_ && node->count_ < kMinValues) {
+    Node *parent = node->parent_;
+    int position = node->position_;
+    if (position > 0 && Child(parent, position - 1)->count_ > kMinValues) {
+      RotateRight(parent, position - 1);
+      return;
+    }
+    if (position < parent->count_ &&
+        Child(parent, position + 1)->count_ > kMinValues) {
+      RotateLeft(parent, position);
+      return;
+    }
+    Merge(parent, position > 0 ? position - 1 : position);
+    node = parent;
+  }
+
+  if (root_->count_ == 0) {
+    Node *old_root = root_;
+    if (old_root->leaf_) {
+      root_ = rightmost_ = nullptr;
+    } else {
+      root_ = Child(old_root, 0);
+      root_->parent_ = nullptr;
+      root_->position_ = 0;
+    }
+    DestroyNode(old_root);
+  }
+}
+
+// Moves the first value of child position + 1 up into the parent, and the
+// parent's separator down to the end of child position.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::RotateLeft(
+    Node *parent, int position) {
+  Node *left = Child(parent, position);
+  Node *right = Child(parent, position + 1);
+  MoveValues(left, left->count_, parent, position, 1);
+  MoveValues(parent, position, right, 0, 1);
+  if (!left->leaf_) SetChild(left, left->count_ + 1, Child(right, 0));
+  ++left->count_;
+
+  MoveValues(right, 0, right, 1, right->count_ - 1);
+  if (!right->leaf_) MoveChildren(right, 0, right, 1, right->count_);
+  --right->count_;
+}
+
+// Mirror of RotateLeft: the last value of child position goes up and the
+// separator moves to the front of child position + 1.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::RotateRight(
+    Node *parent, int position) {
+  Node *left = Child(parent, position);
+  Node *right = Child(parent, position + 1);
+  MoveValues(right, 1, right, 0, right->count_);
+  if (!right->leaf_) MoveChildren(right, 1, right, 0, right->count_ + 1);
+  MoveValues(right, 0, parent, position, 1);
+  MoveValues(parent, position, left, left->count_ - 1, 1);
+  if (!right->leaf_) SetChild(right, 0, Child(left, left->count_));
+  ++right->count_;
+  --left->count_;
+}
+
+// Appends the separator and everything in child position + 1 to child
+// position, then drops the separator and the emptied child from the parent.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::Merge(
+    Node *parent, int position) {
+  Node *left = Child(parent, position);
+  Node *right = Child(parent, position + 1);
+  MoveValues(left, left->count_, parent, position, 1);
+  MoveValues(left, left->count_ + 1, right, 0, right->count_);
+  if (!left->leaf_) {
+    MoveChildren(left, left->count_ + 1, right, 0, right->count_ + 1);
+  }
+  left->count_ += right->count_ + 1;
+  right->count_ = 0;
+  if (right == rightmost_) rightmost_ = left;
+  DestroyNode(right);
+
+  MoveValues(parent, position, parent, position + 1,
+             parent->count_ - position - 1);
+  MoveChildren(parent, position + 1, parent, position + 2,
+               parent->count_ - position - 1);
+  --parent->count_;
+}
+
+// NODES
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+typename s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::Node *
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::CreateNode(bool leaf) {
+  if (leaf) {
+    leaf_allocator alloc(alloc_);
+    Node *node = std::allocator_traits<leaf_allocator>::allocate(alloc, 1);
+    std::allocator_traits<leaf_allocator>::construct(alloc, node, true);
+    return node;
+  }
+  internal_allocator alloc(alloc_);
+  InternalNode *node =
+      std::allocator_traits<internal_allocator>::allocate(alloc, 1);
+  std::allocator_traits<internal_allocator>::construct(alloc, node);
+  return node;
+}
+
+// Destroys the values still held by node, but not its children.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::DestroyNode(
+    Node *node) {
+  for (int i = 0; i < node->count_; ++i) {
+    value_traits::destroy(alloc_, &node->slots_[i].value);
+  }
+  if (node->leaf_) {
+    leaf_allocator alloc(alloc_);
+    std::allocator_traits<leaf_allocator>::destroy(alloc, node);
+    std::allocator_traits<leaf_allocator>::deallocate(alloc, node, 1);
+  } else {
+    internal_allocator alloc(alloc_);
+    InternalNode *internal = static_cast<InternalNode *>(node);
+    std::allocator_traits<internal_allocator>::destroy(alloc, internal);
+    std::allocator_traits<internal_allocator>::deallocate(alloc, internal, 1);
+  }
+}
+
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+void s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::FreeTree(
+    Node *node) {
+  if (node == nullptr) return;
+  if (!node->leaf_) {
+    for (int i = 0; i <= node->count_; ++i) FreeTree(Child(node, i));
+  }
+  DestroyNode(node);
+}
+
+// Rebuilds the subtree below other in nodes from our allocator, moving the
+// values out with kMove. Nothing is left behind on exception.
+template <class Key, class Value, class Compare, class Allocator,
+          size_t NodeBytes>
+template <bool kMove>
+typename s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::Node *
+s21_BTree<Key, Value, Compare, Allocator, NodeBytes>::CopyTree(
+    Node *other, Node *parent, int position) {
+  Node *node = CreateNode(other->leaf_);
+  node->parent_ = parent;
+  node->position_ = position;
+  try {
+    for (; node->count_ < other->count_; ++node->count_) {
+      Value &value = other->slots_[node->count_].value;
+      if constexpr (kMove) {
+        value_traits::construct(alloc_, &node->slots_[node->count_].value,
+                                std::move(value));
+      } else {
+        value_traits::construct(alloc_, &node->slots_[node->count_].value,
+                                value);
+      }
+    }
+    if (!node->leaf_) {
+      for (int i = 0; i <= node->count_; ++i) {
+        Child(node, i) = CopyTree<kMove>(Child(other, i), node, i);
+      }
+    }
+  } catch (...) {
+    FreeTree(node);
+    throw;
+  }
+  return node;
+}
+
+#endif  // S21_BTREE_H
@@ -2,11 +2,24 @@
 #define S21_LIST_H
 
 #include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <utility>
+
+#include "../Allocator/s21_pool_allocator.h"
 
 namespace s21 {
-template <class T>
+// Nodes are allocated through Allocator rebound to the node type; use
+// pool_allocator to recycle them instead of going to the heap every time.
+//
+// The nodes form a ring closed by a sentinel stored in the list itself: the
+// sentinel is end(), its next is the first element and its prev the last.
+// Every node therefore has both neighbours, so iterators are a single
+// pointer, ++ and -- just follow a link, and end() can be decremented.
+template <class T, class Allocator = std::allocator<T>>
 class list {
  public:
   class ListIterator;
@@ -18,8 +31,10 @@ class list {
   using iterator = ListIterator;
   using const_iterator = ListConstIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   list();
+  explicit list(const Allocator& alloc);
   list(size_type n);
   list(std::initializer_list<value_type> const& items);
   list(const list& l);
@@ -30,6 +45,8 @@ class list {
   list& operator=(list&& l);
   list& operator=(list& l);
 
+  allocator_type get_allocator() { return allocator_type(node_alloc_); };
+
   const_reference front();
   const_reference back();
 
@@ -41,20 +58,40 @@ class list {
   bool empty();
   size_type size();
   size_type max_size();
+  void reserve_nodes(size_type n);
 
   void clear();
   iterator insert(iterator pos, const_reference value);
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type&& value);
   void pop_back();
   void push_front(const_reference value);
+  void push_front(value_type&& value);
   void pop_front();
   void swap(list& other);
   void merge(list& other);
+  template <typename Compare>
+  void merge(list& other, Compare comp);
   void splice(iterator pos, list& other);
+  void splice(iterator pos, list& other, iterator it);
+  void splice(iterator pos, list& other, iterator first, iterator last);
   void reverse();
   void unique();
+  template <typename BinaryPredicate>
+  void unique(BinaryPredicate pred);
   void sort();
+  template <typename Compare>
+  void sort(Compare comp);
+
+  template <typename... Args>
+  iterator emplace(iterator pos, Args&&... args);
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
 
   template <typename... Args>
   iterator insert_many(iterator pos, Args&&... args);
@@ -66,119 +103,153 @@ class list {
   void insert_many_front(Args&&... args);
 
  private:
-  struct Node {
+  struct NodeBase {
+    NodeBase* next;
+    NodeBase* prev;
+  };
+
+  struct Node : NodeBase {
     T data;
-    Node* next;
-    Node* prev;
 
-    Node(T data) : data(data), prev(nullptr), next(nullptr) {}
-    Node(Node* prev, Node* next, T data) : data(data), prev(prev), next(next) {}
+    template <typename... Args>
+    explicit Node(Args&&... args)
+        : NodeBase{nullptr, nullptr}, data(std::forward<Args>(args)...) {}
   };
 
-  Node* head_;
-  Node* tail_;
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator node_alloc_;
+  NodeBase sentinel_;
   size_t size_;
+
+  static Node* AsNode(NodeBase* node) { return static_cast<Node*>(node); }
+
+  template <typename... Args>
+  Node* CreateNode(Args&&... args);
+  void DestroyNode(NodeBase* node);
+  void SwapNodes(list& other);
+  void ResetSentinel();
+  static void LinkChain(NodeBase* pos, NodeBase* first, NodeBase* last);
+  static void UnlinkChain(NodeBase* first, NodeBase* last);
+  template <typename Compare>
+  static NodeBase* MergeChains(NodeBase* first, NodeBase* second,
+                               Compare& comp);
 };
 
-template <class T>
-list<T>::list() : head_(nullptr), tail_(nullptr), size_(0) {}
+template <typename T, typename Allocator>
+list<T, Allocator>::list() : list(Allocator()) {}
+
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const Allocator& alloc)
+    : node_alloc_(alloc), sentinel_{&sentinel_, &sentinel_}, size_(0) {}
 
-template <class T>
-list<T>::list(size_type n) : head_(nullptr), tail_(nullptr), size_(0) {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(size_type n) : list() {
   for (size_type i = 0; i < n; ++i) {
     push_back(T());
   }
-  size_ = n;
 }
 
-template <class T>
-list<T>::list(std::initializer_list<value_type> const& items)
-    : head_(nullptr), tail_(nullptr), size_(0) {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(std::initializer_list<value_type> const& items)
+    : list() {
   for (auto item : items) {
     push_back(item);
   }
 }
 
-template <class T>
-list<T>::list(const list& l) : head_(nullptr), tail_(nullptr), size_(0) {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const list& l)
+    : list(node_traits::select_on_container_copy_construction(l.node_alloc_)) {
   for (auto it = l.begin(); it != l.end(); ++it) {
     push_back(*it);
   }
 }
 
-template <class T>
-list<T>::list(list&& l) : head_(nullptr), tail_(nullptr), size_(0) {
-  swap(l);
+template <typename T, typename Allocator>
+list<T, Allocator>::list(list&& l) : list(l.node_alloc_) {
+  SwapNodes(l);
 }
 
-template <class T>
-list<T>& list<T>::operator=(list<T>&& l) {
-  if (this != &l) {
-    swap(l);
+// Nodes change hands when the allocator follows them (or both allocators are
+// interchangeable); otherwise the values are moved into fresh nodes.
+template <typename T, typename Allocator>
+list<T, Allocator>& list<T, Allocator>::operator=(list&& l) {
+  if (this == &l) return *this;
+  clear();
+  if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+    node_alloc_ = l.node_alloc_;
+  }
+  if (node_alloc_ == l.node_alloc_) {
+    SwapNodes(l);
+  } else {
+    for (auto& item : l) {
+      emplace_back(std::move(item));
+    }
     l.clear();
   }
   return *this;
 }
 
-template <class T>
-list<T>& list<T>::operator=(list<T>& l) {
+template <typename T, typename Allocator>
+list<T, Allocator>& list<T, Allocator>::operator=(list& l) {
+  if (this == &l) return *this;
   clear();
+  if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+    node_alloc_ = l.node_alloc_;
+  }
   for (const auto& item : l) {
     push_back(item);
   }
   return *this;
 }
 
-template <class T>
-list<T>::~list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::~list() {
   clear();
 }
 
-template <class T>
-class list<T>::ListIterator {
+template <typename T, typename Allocator>
+class list<T, Allocator>::ListIterator {
+  friend class list;
   friend class ListConstIterator;
 
  public:
-  ListIterator(Node* node, Node* head, Node* tail)
-      : current_(node), head_(head), tail_(tail){};
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
 
-  ListIterator operator++() {
-    if (current_ != nullptr) {
-      current_ = current_->next;
-    } else {
-      current_ = head_;
-    }
+  ListIterator() : current_(nullptr){};
+  explicit ListIterator(NodeBase* node) : current_(node){};
+
+  ListIterator& operator++() {
+    current_ = current_->next;
     return *this;
   }
 
   ListIterator operator++(int) {
-    if (current_ != nullptr) {
-      current_ = current_->next;
-    } else {
-      current_ = head_;
-    }
-    return *this;
+    ListIterator old = *this;
+    current_ = current_->next;
+    return old;
   }
 
-  ListIterator operator--() {
-    if (current_ != nullptr) {
-      current_ = current_->prev;
-    } else {
-      current_ = tail_;
-    }
+  ListIterator& operator--() {
+    current_ = current_->prev;
     return *this;
   }
 
   ListIterator operator--(int) {
-    if (current_ != nullptr) {
-      current_ = current_->prev;
-    } else {
-      current_ = tail_;
-    }
-    return *this;
+    ListIterator old = *this;
+    current_ = current_->prev;
+    return old;
   }
 
-  reference operator*() { return current_->data; }
+  reference operator*() const { return AsNode(current_)->data; }
+  pointer operator->() const { return &AsNode(current_)->data; }
 
   bool operator==(const ListIterator& other) const {
     return current_ == other.current_;
@@ -188,67 +259,60 @@ class list<T>::ListIterator {
     return current_ != other.current_;
   }
 
-  Node* operator&() { return current_; }
-
  private:
-  Node* current_;
-  Node* head_;
-  Node* tail_;
+  NodeBase* current_;
 };
 
-template <class T>
-class list<T>::ListConstIterator {
-  friend class ListIterator;
+template <typename T, typename Allocator>
+class list<T, Allocator>::ListConstIterator {
+  friend class list;
 
  public:
-  ListConstIterator(Node* node, Node* head, Node* tail)
-      : current_(node), head_(head), tail_(tail){};
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T*;
+  using reference = const T&;
+
+  ListConstIterator() : current_(nullptr){};
+  explicit ListConstIterator(const NodeBase* node) : current_(node){};
 
-  explicit ListConstIterator(const typename list<T>::ListIterator& other)
-      : current_(other.current_), head_(other.head_), tail_(other.tail_) {}
+  explicit ListConstIterator(const ListIterator& other)
+      : current_(other.current_) {}
 
-  ListConstIterator& operator=(const typename list<T>::ListIterator& other) {
+  ListConstIterator& operator=(const ListIterator& other) {
     current_ = other.current_;
     return *this;
   }
 
-  ListConstIterator operator++() {
-    if (current_ != nullptr) {
-      current_ = current_->next;
-    } else {
-      current_ = head_;
-    }
+  ListConstIterator& operator++() {
+    current_ = current_->next;
     return *this;
   }
 
   ListConstIterator operator++(int) {
-    if (current_ != nullptr) {
-      current_ = current_->next;
-    } else {
-      current_ = head_;
-    }
-    return *this;
+    ListConstIterator old = *this;
+    current_ = current_->next;
+    return old;
   }
 
-  ListConstIterator operator--() {
-    if (current_ != nullptr) {
-      current_ = current_->prev;
-    } else {
-      current_ = tail_;
-    }
+  ListConstIterator& operator--() {
+    current_ = current_->prev;
     return *this;
   }
 
   ListConstIterator operator--(int) {
-    if (current_ != nullptr) {
-      current_ = current_->prev;
-    } else {
-      current_ = tail_;
-    }
-    return *this;
+    ListConstIterator old = *this;
+    current_ = current_->prev;
+    return old;
   }
 
-  const_reference operator*() const { return current_->data; }
+  const_reference operator*() const {
+    return static_cast<const Node*>(current_)->data;
+  }
+  pointer operator->() const {
+    return &static_cast<const Node*>(current_)->data;
+  }
 
   bool operator==(const ListConstIterator& other) const {
     return current_ == other.current_;
@@ -258,273 +322,411 @@ class list<T>::ListConstIterator {
     return current_ != other.current_;
   }
 
-  const Node* operator&() { return current_; }
-
  private:
-  const Node* current_;
-  Node* head_;
-  Node* tail_;
+  const NodeBase* current_;
 };
 
-template <class T>
-typename list<T>::const_reference list<T>::front() {
-  return head_->data;
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_reference list<T, Allocator>::front() {
+  return AsNode(sentinel_.next)->data;
 }
 
-template <class T>
-typename list<T>::const_reference list<T>::back() {
-  return tail_->data;
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_reference list<T, Allocator>::back() {
+  return AsNode(sentinel_.prev)->data;
 }
 
-template <class T>
-typename list<T>::iterator list<T>::begin() {
-  return iterator(head_, head_, tail_);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::begin() {
+  return iterator(sentinel_.next);
 }
 
-template <class T>
-typename list<T>::iterator list<T>::end() {
-  return iterator(nullptr, head_, tail_);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::end() {
+  return iterator(&sentinel_);
 }
 
-template <class T>
-typename list<T>::const_iterator list<T>::begin() const {
-  return const_iterator(head_, head_, tail_);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::begin() const {
+  return const_iterator(sentinel_.next);
 }
 
-template <class T>
-typename list<T>::const_iterator list<T>::end() const {
-  return const_iterator(nullptr, head_, tail_);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::end() const {
+  return const_iterator(&sentinel_);
 }
 
-template <class T>
-bool list<T>::empty() {
+template <typename T, typename Allocator>
+bool list<T, Allocator>::empty() {
   return size_ == 0;
 }
 
-template <class T>
-typename list<T>::size_type list<T>::size() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::size() {
   return size_;
 }
 
-template <class T>
-typename list<T>::size_type list<T>::max_size() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::max_size() {
   return std::numeric_limits<size_type>::max() / sizeof(Node);
 }
 
-template <typename T>
-void list<T>::push_back(const_reference value) {
-  Node* ptr = new Node(value);
-  ptr->prev = tail_;
-  if (tail_ != nullptr) {
-    tail_->next = ptr;
-  }
-  if (head_ == nullptr) {
-    head_ = ptr;
-  }
-  ++size_;
-  tail_ = ptr;
+// Lets allocators that keep a node pool (see pool_allocator) prepare room for
+// n elements in total; a no-op for the others.
+template <typename T, typename Allocator>
+void list<T, Allocator>::reserve_nodes(size_type n) {
+  if (n > size_) reserve_allocator(node_alloc_, n - size_);
 }
 
-template <typename T>
-void list<T>::push_front(const_reference value) {
-  Node* ptr = new Node(value);
-  ptr->next = head_;
-  if (head_ != nullptr) {
-    head_->prev = ptr;
-  }
-  if (head_ == nullptr) {
-    head_ = ptr;
-  }
-  ++size_;
-  head_ = ptr;
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
 }
 
-template <typename T>
-void list<T>::pop_front() {
-  if (head_ == nullptr) return;
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
 
-  Node* ptr = head_->next;
-  if (ptr != nullptr)
-    ptr->prev = nullptr;
-  else
-    tail_ = nullptr;
-  delete head_;
-  head_ = ptr;
-  --size_;
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(const_reference value) {
+  emplace_front(value);
 }
 
-template <typename T>
-void list<T>::pop_back() {
-  if (tail_ == nullptr) return;
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(value_type&& value) {
+  emplace_front(std::move(value));
+}
 
-  Node* ptr = tail_->prev;
-  if (ptr != nullptr)
-    ptr->next = nullptr;
-  else
-    head_ = nullptr;
-  delete tail_;
-  tail_ = ptr;
-  --size_;
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::reference list<T, Allocator>::emplace_back(
+    Args&&... args) {
+  return *emplace(end(), std::forward<Args>(args)...);
 }
 
-template <typename T>
-void list<T>::clear() {
-  while (head_ != nullptr) pop_front();
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::reference list<T, Allocator>::emplace_front(
+    Args&&... args) {
+  return *emplace(begin(), std::forward<Args>(args)...);
+}
 
-  head_ = nullptr;
-  tail_ = nullptr;
-  size_ = 0;
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_front() {
+  erase(begin());
 }
 
-template <typename T>
-typename list<T>::iterator list<T>::insert(iterator pos,
-                                           const_reference value) {
-  if (pos == begin()) {
-    push_front(value);
-    return begin();
-  } else if (pos == end()) {
-    push_back(value);
-    return iterator(tail_, head_, tail_);
-  } else {
-    Node* current = &pos;
-    Node* old_element = current;
-    Node* new_element = new Node(value);
-    new_element->next = old_element;
-    new_element->prev = old_element->prev;
-    if (old_element->prev != nullptr) {
-      old_element->prev->next = new_element;
-    }
-    old_element->prev = new_element;
-    size_++;
-    return iterator(new_element, head_, tail_);
-  }
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_back() {
+  erase(iterator(sentinel_.prev));
 }
 
-template <typename T>
-void list<T>::erase(iterator pos) {
-  if (pos == end()) return;
-  if (&pos == tail_)
-    pop_back();
-  else if (pos == begin()) {
-    pop_front();
-  } else {
-    Node* current = &pos;
-    current->prev->next = current->next;
-    current->next->prev = current->prev;
-    delete current;
-    size_--;
+template <typename T, typename Allocator>
+void list<T, Allocator>::clear() {
+  NodeBase* current = sentinel_.next;
+  while (current != &sentinel_) {
+    NodeBase* next = current->next;
+    DestroyNode(current);
+    current = next;
   }
+  ResetSentinel();
 }
 
-template <typename T>
-void list<T>::swap(list& other) {
-  using std::swap;
-  swap(this->head_, other.head_);
-  swap(this->tail_, other.tail_);
-  swap(this->size_, other.size_);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert(iterator pos,
+                                           const_reference value) {
+  return emplace(pos, value);
 }
 
-template <typename T>
-void list<T>::reverse() {
-  if (size_ < 2) return;
-  Node* current = head_;
-  Node* prev = nullptr;
-  while (current != nullptr) {
-    Node* next = current->next;
-    current->next = prev;
-    current->prev = next;
-    prev = current;
-    current = next;
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::iterator list<T, Allocator>::emplace(iterator pos,
+                                                         Args&&... args) {
+  Node* node = CreateNode(std::forward<Args>(args)...);
+  LinkChain(pos.current_, node, node);
+  ++size_;
+  return iterator(node);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::erase(iterator pos) {
+  if (pos.current_ == &sentinel_) return;
+  UnlinkChain(pos.current_, pos.current_);
+  DestroyNode(pos.current_);
+  --size_;
+}
+
+// Allocators are exchanged only when they propagate on swap; otherwise they
+// must compare equal.
+template <typename T, typename Allocator>
+void list<T, Allocator>::swap(list& other) {
+  if constexpr (node_traits::propagate_on_container_swap::value) {
+    std::swap(node_alloc_, other.node_alloc_);
   }
-  std::swap(head_, tail_);
+  SwapNodes(other);
 }
 
-template <typename T>
-void list<T>::unique() {
-  if (size_ < 2) return;
-  iterator current = begin();
-  while (current != end()) {
-    iterator next = current;
-    ++next;
-    while (next != end() && *current == *next) {
-      erase(next);
-      next = current;
-      ++next;
+// The sentinels live inside the lists, so after exchanging them the first
+// and last nodes of each ring are pointed back at their new owner.
+template <typename T, typename Allocator>
+void list<T, Allocator>::SwapNodes(list& other) {
+  std::swap(sentinel_, other.sentinel_);
+  std::swap(size_, other.size_);
+  for (list* owner : {this, &other}) {
+    if (owner->size_ == 0) {
+      owner->ResetSentinel();
+    } else {
+      owner->sentinel_.next->prev = &owner->sentinel_;
+      owner->sentinel_.prev->next = &owner->sentinel_;
     }
-    ++current;
   }
 }
 
-template <typename T>
-void list<T>::sort() {
-  for (iterator current = begin(); current != end(); ++current) {
-    iterator pos = current;
-    ++pos;
-    while (pos != end()) {
-      if (*current > *pos) std::swap(*pos, *current);
-      ++pos;
+template <typename T, typename Allocator>
+void list<T, Allocator>::ResetSentinel() {
+  sentinel_.next = &sentinel_;
+  sentinel_.prev = &sentinel_;
+  size_ = 0;
+}
+
+// Links the chain first..last, already joined through next and prev, in
+// front of pos.
+template <typename T, typename Allocator>
+void list<T, Allocator>::LinkChain(NodeBase* pos, NodeBase* first,
+                                   NodeBase* last) {
+  NodeBase* before = pos->prev;
+  first->prev = before;
+  last->next = pos;
+  before->next = first;
+  pos->prev = last;
+}
+
+// Detaches first..last from their ring; their outer links are left as they
+// were. The size is up to the caller.
+template <typename T, typename Allocator>
+void list<T, Allocator>::UnlinkChain(NodeBase* first, NodeBase* last) {
+  first->prev->next = last->next;
+  last->next->prev = first->prev;
+}
+
+// Swapping the two links of every node, the sentinel included, turns the
+// ring around.
+template <typename T, typename Allocator>
+void list<T, Allocator>::reverse() {
+  NodeBase* current = &sentinel_;
+  do {
+    std::swap(current->next, current->prev);
+    current = current->prev;
+  } while (current != &sentinel_);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::unique() {
+  unique(std::equal_to<T>());
+}
+
+// Each element is compared with the first one of its group, which stays.
+template <typename T, typename Allocator>
+template <typename BinaryPredicate>
+void list<T, Allocator>::unique(BinaryPredicate pred) {
+  if (size_ < 2) return;
+  NodeBase* current = sentinel_.next;
+  NodeBase* next = current->next;
+  while (next != &sentinel_) {
+    if (pred(AsNode(current)->data, AsNode(next)->data)) {
+      UnlinkChain(next, next);
+      DestroyNode(next);
+      --size_;
+    } else {
+      current = next;
     }
+    next = current->next;
   }
 }
 
-template <typename T>
-void list<T>::merge(list& other) {
-  if (other.empty()) return;
-  if (empty()) {
-    *this = std::move(other);
-    return;
-  }
-  iterator current = begin();
-  iterator o_current = other.begin();
-  while (current != end() && o_current != other.end()) {
-    if (*o_current < *current) {
-      insert(current, *o_current);
-      ++o_current;
-    } else
-      ++current;
+template <typename T, typename Allocator>
+void list<T, Allocator>::sort() {
+  sort(std::less<T>());
+}
+
+// Bottom-up merge sort on the next links: bin i holds a sorted run of 2^i
+// nodes, and every node taken off the list is carried up through the bins
+// like a binary counter. Stable, O(n log n), and only pointers are moved;
+// the prev links are rebuilt in one pass at the end.
+template <typename T, typename Allocator>
+template <typename Compare>
+void list<T, Allocator>::sort(Compare comp) {
+  if (size_ < 2) return;
+  NodeBase* bins[std::numeric_limits<size_type>::digits] = {};
+  size_type used = 0;
+  sentinel_.prev->next = nullptr;
+  NodeBase* current = sentinel_.next;
+  while (current != nullptr) {
+    NodeBase* carry = current;
+    current = current->next;
+    carry->next = nullptr;
+    size_type i = 0;
+    for (; i < used && bins[i] != nullptr; ++i) {
+      carry = MergeChains(bins[i], carry, comp);
+      bins[i] = nullptr;
+    }
+    bins[i] = carry;
+    if (i == used) ++used;
+  }
+  NodeBase* sorted = nullptr;
+  for (size_type i = 0; i < used; ++i) {
+    if (bins[i] != nullptr) sorted = MergeChains(bins[i], sorted, comp);
+  }
+
+  NodeBase* prev = &sentinel_;
+  for (NodeBase* node = sorted; node != nullptr; node = node->next) {
+    prev->next = node;
+    node->prev = prev;
+    prev = node;
+  }
+  prev->next = &sentinel_;
+  sentinel_.prev = prev;
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::merge(list& other) {
+  merge(other, std::less<T>());
+}
+
+// Relinks the nodes of other into place in a single pass; on ties the
+// elements of *this come first. Both lists must be sorted by comp, and their
+// allocators must compare equal, as for splice.
+template <typename T, typename Allocator>
+template <typename Compare>
+void list<T, Allocator>::merge(list& other, Compare comp) {
+  if (this == &other || other.size_ == 0) return;
+  NodeBase* current = sentinel_.next;
+  NodeBase* o_current = other.sentinel_.next;
+  NodeBase* o_end = &other.sentinel_;
+  while (current != &sentinel_ && o_current != o_end) {
+    if (comp(AsNode(o_current)->data, AsNode(current)->data)) {
+      NodeBase* next = o_current->next;
+      LinkChain(current, o_current, o_current);
+      o_current = next;
+    } else {
+      current = current->next;
+    }
   }
-  while (o_current != other.end()) {
-    insert(current, *o_current);
-    ++o_current;
+  if (o_current != o_end) {
+    LinkChain(&sentinel_, o_current, other.sentinel_.prev);
   }
-  other.clear();
+  size_ += other.size_;
+  other.ResetSentinel();
 }
 
-template <typename T>
-void list<T>::splice(iterator pos, list& other) {
-  for (iterator current = other.begin(); current != other.end(); ++current)
-    insert(pos, *current);
-  other.clear();
+// The splice overloads move nodes between lists without copying or
+// allocating, so the allocators must compare equal.
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(iterator pos, list& other) {
+  if (this == &other || other.size_ == 0) return;
+  LinkChain(pos.current_, other.sentinel_.next, other.sentinel_.prev);
+  size_ += other.size_;
+  other.ResetSentinel();
 }
 
-template <typename T>
-template <typename... Args>
-typename list<T>::iterator list<T>::insert_many(iterator pos, Args&&... args) {
-  for (const auto& arg : std::initializer_list<int>{args...}) {
-    insert(pos, arg);
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(iterator pos, list& other, iterator it) {
+  NodeBase* node = it.current_;
+  if (node == &other.sentinel_) return;
+  if (node == pos.current_ || node->next == pos.current_) return;
+  UnlinkChain(node, node);
+  --other.size_;
+  LinkChain(pos.current_, node, node);
+  ++size_;
+}
+
+// Linear in the length of the range when other is a different list, since
+// the moved elements have to be counted.
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(iterator pos, list& other, iterator first,
+                                iterator last) {
+  if (first == last || last == pos) return;
+  NodeBase* first_node = first.current_;
+  NodeBase* last_node = last.current_->prev;
+  if (this != &other) {
+    size_type count = 1;
+    for (NodeBase* node = first_node; node != last_node; node = node->next) {
+      ++count;
+    }
+    other.size_ -= count;
+    size_ += count;
   }
-  for (const auto& arg : std::initializer_list<int>{args...}) {
+  UnlinkChain(first_node, last_node);
+  LinkChain(pos.current_, first_node, last_node);
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert_many(
+    iterator pos, Args&&... args) {
+  (emplace(pos, std::forward<Args>(args)), ...);
+  for (size_type i = 0; i < sizeof...(Args); ++i) {
     --pos;
   }
   return pos;
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_back(Args&&... args) {
-  for (const auto& arg : std::initializer_list<int>{args...}) {
-    push_back(arg);
-  }
+void list<T, Allocator>::insert_many_back(Args&&... args) {
+  (emplace_back(std::forward<Args>(args)), ...);
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_front(Args&&... args) {
-  for (const auto& arg : std::initializer_list<int>{args...}) {
-    push_front(arg);
+void list<T, Allocator>::insert_many_front(Args&&... args) {
+  (emplace_front(std::forward<Args>(args)), ...);
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::Node* list<T, Allocator>::CreateNode(
+    Args&&... args) {
+  Node* node = node_traits::allocate(node_alloc_, 1);
+  try {
+    node_traits::construct(node_alloc_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(node_alloc_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::DestroyNode(NodeBase* node) {
+  Node* full = AsNode(node);
+  node_traits::destroy(node_alloc_, full);
+  node_traits::deallocate(node_alloc_, full, 1);
+}
+
+// Merges two sorted null-terminated chains linked through next only. On ties
+// the node from first wins, which keeps the sort stable.
+template <typename T, typename Allocator>
+template <typename Compare>
+typename list<T, Allocator>::NodeBase* list<T, Allocator>::MergeChains(
+    NodeBase* first, NodeBase* second, Compare& comp) {
+  NodeBase* result = nullptr;
+  NodeBase** link = &result;
+  while (first != nullptr && second != nullptr) {
+    if (comp(AsNode(second)->data, AsNode(first)->data)) {
+      *link = second;
+      second = second->next;
+    } else {
+      *link = first;
+      first = first->next;
+    }
+    link = &(*link)->next;
   }
+  *link = first != nullptr ? first : second;
+  return result;
 }
 
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
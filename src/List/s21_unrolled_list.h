@@ -0,0 +1,721 @@
+#ifndef S21_UNROLLED_LIST_H
+#define S21_UNROLLED_LIST_H
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+// Doubly linked list of chunks, each holding up to ChunkSize elements packed
+// at its front. Traversal walks through contiguous memory and pays for the
+// links once per chunk instead of once per element. Inserting into a full
+// chunk splits it in two halves; an erase that leaves a chunk less than half
+// full folds the next chunk into it when both fit. The chunks form a ring
+// closed by a sentinel stored in the list, as in list.
+//
+// Unlike list, elements move within their chunk on insert and erase, so
+// those invalidate iterators to the chunk involved, and T must be nothrow
+// move constructible.
+template <class T, size_t ChunkSize = 16, class Allocator = std::allocator<T>>
+class unrolled_list {
+ public:
+  class UnrolledIterator;
+  class UnrolledConstIterator;
+
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = UnrolledIterator;
+  using const_iterator = UnrolledConstIterator;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  static_assert(ChunkSize >= 2, "ChunkSize must be at least 2");
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "unrolled_list requires a nothrow move constructible T");
+
+  unrolled_list();
+  explicit unrolled_list(const Allocator& alloc);
+  unrolled_list(size_type n);
+  unrolled_list(std::initializer_list<value_type> const& items);
+  unrolled_list(const unrolled_list& l);
+  unrolled_list(unrolled_list&& l);
+
+  ~unrolled_list();
+
+  unrolled_list& operator=(unrolled_list&& l);
+  unrolled_list& operator=(const unrolled_list& l);
+
+  allocator_type get_allocator() { return allocator_type(chunk_alloc_); };
+
+  const_reference front() { return *begin(); };
+  const_reference back() { return *--end(); };
+
+  iterator begin() { return iterator(sentinel_.next, 0); };
+  iterator end() { return iterator(&sentinel_, 0); };
+  const_iterator begin() const { return const_iterator(sentinel_.next, 0); };
+  const_iterator end() const { return const_iterator(&sentinel_, 0); };
+
+  bool empty() { return size_ == 0; };
+  size_type size() { return size_; };
+  size_type max_size();
+
+  void clear();
+  iterator insert(iterator pos, const_reference value);
+  void erase(iterator pos);
+  void push_back(const_reference value) { emplace_back(value); };
+  void push_back(value_type&& value) { emplace_back(std::move(value)); };
+  void pop_back() { erase(--end()); };
+  void push_front(const_reference value) { emplace_front(value); };
+  void push_front(value_type&& value) { emplace_front(std::move(value)); };
+  void pop_front() { erase(begin()); };
+  void swap(unrolled_list& other);
+  void merge(unrolled_list& other);
+  template <typename Compare>
+  void merge(unrolled_list& other, Compare comp);
+  void splice(iterator pos, unrolled_list& other);
+  void reverse();
+  void unique();
+  template <typename BinaryPredicate>
+  void unique(BinaryPredicate pred);
+  void sort();
+  template <typename Compare>
+  void sort(Compare comp);
+
+  template <typename... Args>
+  iterator emplace(iterator pos, Args&&... args);
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
+
+  template <typename... Args>
+  iterator insert_many(iterator pos, Args&&... args);
+
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+  template <typename... Args>
+  void insert_many_front(Args&&... args);
+
+ private:
+  struct ChunkBase {
+    ChunkBase* next;
+    ChunkBase* prev;
+    size_type count;
+  };
+
+  struct Chunk : ChunkBase {
+    alignas(T) unsigned char storage[ChunkSize * sizeof(T)];
+  };
+
+  using chunk_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Chunk>;
+  using chunk_traits = std::allocator_traits<chunk_allocator>;
+
+  chunk_allocator chunk_alloc_;
+  ChunkBase sentinel_;
+  size_type size_;
+
+  static T* Data(ChunkBase* chunk) {
+    return std::launder(
+        reinterpret_cast<T*>(static_cast<Chunk*>(chunk)->storage));
+  };
+  static const T* Data(const ChunkBase* chunk) {
+    return std::launder(
+        reinterpret_cast<const T*>(static_cast<const Chunk*>(chunk)->storage));
+  };
+
+  ChunkBase* CreateChunk(ChunkBase* pos);
+  void DestroyChunk(ChunkBase* chunk);
+  ChunkBase* SplitChunk(ChunkBase* chunk, size_type index);
+  void FoldNext(ChunkBase* chunk);
+  void SwapChunks(unrolled_list& other);
+  void ResetSentinel();
+  static void Relocate(T* from, size_type count, T* to);
+  static void LinkChain(ChunkBase* pos, ChunkBase* first, ChunkBase* last);
+  static void UnlinkChain(ChunkBase* first, ChunkBase* last);
+};
+
+template <typename T, size_t ChunkSize, typename Allocator>
+class unrolled_list<T, ChunkSize, Allocator>::UnrolledIterator {
+  friend class unrolled_list;
+  friend class UnrolledConstIterator;
+
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+
+  UnrolledIterator() : chunk_(nullptr), index_(0){};
+  UnrolledIterator(ChunkBase* chunk, size_type index)
+      : chunk_(chunk), index_(index){};
+
+  UnrolledIterator& operator++() {
+    if (++index_ == chunk_->count) {
+      chunk_ = chunk_->next;
+      index_ = 0;
+    }
+    return *this;
+  }
+
+  UnrolledIterator operator++(int) {
+    UnrolledIterator old = *this;
+    ++*this;
+    return old;
+  }
+
+  UnrolledIterator& operator--() {
+    if (index_ == 0) {
+      chunk_ = chunk_->prev;
+      index_ = chunk_->count;
+    }
+    --index_;
+    return *this;
+  }
+
+  UnrolledIterator operator--(int) {
+    UnrolledIterator old = *this;
+    --*this;
+    return old;
+  }
+
+  reference operator*() const { return Data(chunk_)[index_]; }
+  pointer operator->() const { return Data(chunk_) + index_; }
+
+  bool operator==(const UnrolledIterator& other) const {
+    return chunk_ == other.chunk_ && index_ == other.index_;
+  }
+
+  bool operator!=(const UnrolledIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  ChunkBase* chunk_;
+  size_type index_;
+};
+
+template <typename T, size_t ChunkSize, typename Allocator>
+class unrolled_list<T, ChunkSize, Allocator>::UnrolledConstIterator {
+  friend class unrolled_list;
+
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T*;
+  using reference = const T&;
+
+  UnrolledConstIterator() : chunk_(nullptr), index_(0){};
+  UnrolledConstIterator(const ChunkBase* chunk, size_type index)
+      : chunk_(chunk), index_(index){};
+  explicit UnrolledConstIterator(const UnrolledIterator& other)
+      : chunk_(other.chunk_), index_(other.index_){};
+
+  UnrolledConstIterator& operator++() {
+    if (++index_ == chunk_->count) {
+      chunk_ = chunk_->next;
+      index_ = 0;
+    }
+    return *this;
+  }
+
+  UnrolledConstIterator operator++(int) {
+    UnrolledConstIterator old = *this;
+    ++*this;
+    return old;
+  }
+
+  UnrolledConstIterator& operator--() {
+    if (index_ == 0) {
+      chunk_ = chunk_->prev;
+      index_ = chunk_->count;
+    }
+    --index_;
+    return *this;
+  }
+
+  UnrolledConstIterator operator--(int) {
+    UnrolledConstIterator old = *this;
+    --*this;
+    return old;
+  }
+
+  reference operator*() const { return Data(chunk_)[index_]; }
+  pointer operator->() const { return Data(chunk_) + index_; }
+
+  bool operator==(const UnrolledConstIterator& other) const {
+    return chunk_ == other.chunk_ && index_ == other.index_;
+  }
+
+  bool operator!=(const UnrolledConstIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  const ChunkBase* chunk_;
+  size_type index_;
+};
+
+template <typename T, size_t ChunkSize, typename Allocator>
+unrolled_list<T, ChunkSize, Allocator>::unrolled_list()
+    : unrolled_list(Allocator()) {}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+unrolled_list<T, ChunkSize, Allocator>::unrolled_list(const Allocator& alloc)
+    : chunk_alloc_(alloc), sentinel_{&sentinel_, &sentinel_, 0}, size_(0) {}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+unrolled_list<T, ChunkSize, Allocator>::unrolled_list(size_type n)
+    : unrolled_list() {
+  for (size_type i = 0; i < n; ++i) {
+    emplace_back();
+  }
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+unrolled_list<T, ChunkSize, Allocator>::unrolled_list(
+    std::initializer_list<value_type> const& items)
+    : unrolled_list() {
+  for (const auto& item : items) {
+    emplace_back(item);
+  }
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+unrolled_list<T, ChunkSize, Allocator>::unrolled_list(const unrolled_list& l)
+    : unrolled_list(
+          chunk_traits::select_on_container_copy_construction(l.chunk_alloc_)) {
+  for (const auto& item : l) {
+    emplace_back(item);
+  }
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+unrolled_list<T, ChunkSize, Allocator>::unrolled_list(unrolled_list&& l)
+    : unrolled_list(l.chunk_alloc_) {
+  SwapChunks(l);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+unrolled_list<T, ChunkSize, Allocator>::~unrolled_list() {
+  clear();
+}
+
+// Chunks change hands when the allocator follows them (or both allocators
+// are interchangeable); otherwise the values are moved into fresh chunks.
+template <typename T, size_t ChunkSize, typename Allocator>
+unrolled_list<T, ChunkSize, Allocator>&
+unrolled_list<T, ChunkSize, Allocator>::operator=(unrolled_list&& l) {
+  if (this == &l) return *this;
+  clear();
+  if constexpr (chunk_traits::propagate_on_container_move_assignment::value) {
+    chunk_alloc_ = l.chunk_alloc_;
+  }
+  if (chunk_alloc_ == l.chunk_alloc_) {
+    SwapChunks(l);
+  } else {
+    for (auto& item : l) {
+      emplace_back(std::move(item));
+    }
+    l.clear();
+  }
+  return *this;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+unrolled_list<T, ChunkSize, Allocator>&
+unrolled_list<T, ChunkSize, Allocator>::operator=(const unrolled_list& l) {
+  if (this == &l) return *this;
+  clear();
+  if constexpr (chunk_traits::propagate_on_container_copy_assignment::value) {
+    chunk_alloc_ = l.chunk_alloc_;
+  }
+  for (const auto& item : l) {
+    emplace_back(item);
+  }
+  return *this;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+typename unrolled_list<T, ChunkSize, Allocator>::size_type
+unrolled_list<T, ChunkSize, Allocator>::max_size() {
+  return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::clear() {
+  ChunkBase* chunk = sentinel_.next;
+  while (chunk != &sentinel_) {
+    ChunkBase* next = chunk->next;
+    DestroyChunk(chunk);
+    chunk = next;
+  }
+  ResetSentinel();
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+typename unrolled_list<T, ChunkSize, Allocator>::iterator
+unrolled_list<T, ChunkSize, Allocator>::insert(iterator pos,
+                                               const_reference value) {
+  return emplace(pos, value);
+}
+
+// At the end the element goes into the last chunk while it has room;
+// elsewhere a full chunk is split first.
+template <typename T, size_t ChunkSize, typename Allocator>
+template <typename... Args>
+typename unrolled_list<T, ChunkSize, Allocator>::iterator
+unrolled_list<T, ChunkSize, Allocator>::emplace(iterator pos,
+                                                Args&&... args) {
+  // built first: args may refer to an element that is about to move
+  T value(std::forward<Args>(args)...);
+  ChunkBase* chunk = pos.chunk_;
+  size_type index = pos.index_;
+  if (chunk == &sentinel_) {
+    chunk = sentinel_.prev;
+    if (chunk == &sentinel_ || chunk->count == ChunkSize) {
+      chunk = CreateChunk(&sentinel_);
+    }
+    index = chunk->count;
+  } else if (chunk->count == ChunkSize) {
+    ChunkBase* upper = SplitChunk(chunk, ChunkSize / 2);
+    if (index > ChunkSize / 2) {
+      chunk = upper;
+      index -= ChunkSize / 2;
+    }
+  }
+  T* data = Data(chunk);
+  Relocate(data + index, chunk->count - index, data + index + 1);
+  new (data + index) T(std::move(value));
+  ++chunk->count;
+  ++size_;
+  return iterator(chunk, index);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+template <typename... Args>
+typename unrolled_list<T, ChunkSize, Allocator>::reference
+unrolled_list<T, ChunkSize, Allocator>::emplace_back(Args&&... args) {
+  return *emplace(end(), std::forward<Args>(args)...);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+template <typename... Args>
+typename unrolled_list<T, ChunkSize, Allocator>::reference
+unrolled_list<T, ChunkSize, Allocator>::emplace_front(Args&&... args) {
+  return *emplace(begin(), std::forward<Args>(args)...);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::erase(iterator pos) {
+  ChunkBase* chunk = pos.chunk_;
+  if (chunk == &sentinel_) return;
+  T* data = Data(chunk);
+  data[pos.index_].~T();
+  Relocate(data + pos.index_ + 1, chunk->count - pos.index_ - 1,
+           data + pos.index_);
+  --chunk->count;
+  --size_;
+  if (chunk->count == 0) {
+    UnlinkChain(chunk, chunk);
+    DestroyChunk(chunk);
+  } else {
+    FoldNext(chunk);
+  }
+}
+
+// Allocators are exchanged only when they propagate on swap; otherwise they
+// must compare equal.
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::swap(unrolled_list& other) {
+  if constexpr (chunk_traits::propagate_on_container_swap::value) {
+    std::swap(chunk_alloc_, other.chunk_alloc_);
+  }
+  SwapChunks(other);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::merge(unrolled_list& other) {
+  merge(other, std::less<T>());
+}
+
+// Elements cannot be relinked one by one as in list, so both sequences are
+// moved, in merged order, into freshly filled chunks. On ties the elements
+// of *this come first.
+template <typename T, size_t ChunkSize, typename Allocator>
+template <typename Compare>
+void unrolled_list<T, ChunkSize, Allocator>::merge(unrolled_list& other,
+                                                   Compare comp) {
+  if (this == &other || other.size_ == 0) return;
+  unrolled_list merged(get_allocator());
+  iterator current = begin();
+  iterator o_current = other.begin();
+  while (current != end() && o_current != other.end()) {
+    if (comp(*o_current, *current)) {
+      merged.emplace_back(std::move(*o_current++));
+    } else {
+      merged.emplace_back(std::move(*current++));
+    }
+  }
+  for (; current != end(); ++current) merged.emplace_back(std::move(*current));
+  for (; o_current != other.end(); ++o_current) {
+    merged.emplace_back(std::move(*o_current));
+  }
+  other.clear();
+  clear();
+  SwapChunks(merged);
+}
+
+// The chunk holding pos is split there, then the chunks of other are linked
+// in as they are; nothing is copied or allocated beyond that one split.
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::splice(iterator pos,
+                                                    unrolled_list& other) {
+  if (this == &other || other.size_ == 0) return;
+  ChunkBase* before = pos.chunk_;
+  if (before != &sentinel_ && pos.index_ != 0) {
+    before = SplitChunk(before, pos.index_);
+  }
+  LinkChain(before, other.sentinel_.next, other.sentinel_.prev);
+  size_ += other.size_;
+  other.ResetSentinel();
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::reverse() {
+  ChunkBase* chunk = &sentinel_;
+  do {
+    std::swap(chunk->next, chunk->prev);
+    if (chunk != &sentinel_) {
+      std::reverse(Data(chunk), Data(chunk) + chunk->count);
+    }
+    chunk = chunk->prev;
+  } while (chunk != &sentinel_);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::unique() {
+  unique(std::equal_to<T>());
+}
+
+// Compacts the kept elements towards the front in one pass, then drops the
+// leftover tail. Every chunk keeps its fill count except the last one kept,
+// which is trimmed; nothing is repacked.
+template <typename T, size_t ChunkSize, typename Allocator>
+template <typename BinaryPredicate>
+void unrolled_list<T, ChunkSize, Allocator>::unique(BinaryPredicate pred) {
+  if (size_ < 2) return;
+  iterator kept = begin();
+  iterator read = kept;
+  size_type count = 1;
+  for (++read; read != end(); ++read) {
+    if (pred(*kept, *read)) continue;
+    ++kept;
+    if (kept != read) *kept = std::move(*read);
+    ++count;
+  }
+
+  ChunkBase* last = kept.chunk_;
+  T* data = Data(last);
+  for (size_type i = kept.index_ + 1; i < last->count; ++i) {
+    data[i].~T();
+  }
+  last->count = kept.index_ + 1;
+  ChunkBase* chunk = last->next;
+  while (chunk != &sentinel_) {
+    ChunkBase* next = chunk->next;
+    DestroyChunk(chunk);
+    chunk = next;
+  }
+  last->next = &sentinel_;
+  sentinel_.prev = last;
+  size_ = count;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::sort() {
+  sort(std::less<T>());
+}
+
+// The elements are moved out to a contiguous buffer, stable-sorted there and
+// moved back into the same slots; the chunks themselves stay put.
+template <typename T, size_t ChunkSize, typename Allocator>
+template <typename Compare>
+void unrolled_list<T, ChunkSize, Allocator>::sort(Compare comp) {
+  if (size_ < 2) return;
+  std::vector<T, Allocator> buffer(get_allocator());
+  buffer.reserve(size_);
+  for (auto& item : *this) {
+    buffer.push_back(std::move(item));
+  }
+  std::stable_sort(buffer.begin(), buffer.end(), comp);
+  auto source = buffer.begin();
+  for (auto& item : *this) {
+    item = std::move(*source++);
+  }
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+template <typename... Args>
+typename unrolled_list<T, ChunkSize, Allocator>::iterator
+unrolled_list<T, ChunkSize, Allocator>::insert_many(iterator pos,
+                                                    Args&&... args) {
+  // an insert may split the chunk under pos, so pos is refreshed each time
+  auto insert_one = [this, &pos](auto&& arg) {
+    pos = ++emplace(pos, std::forward<decltype(arg)>(arg));
+  };
+  (insert_one(std::forward<Args>(args)), ...);
+  for (size_type i = 0; i < sizeof...(Args); ++i) {
+    --pos;
+  }
+  return pos;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+template <typename... Args>
+void unrolled_list<T, ChunkSize, Allocator>::insert_many_back(Args&&... args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+template <typename... Args>
+void unrolled_list<T, ChunkSize, Allocator>::insert_many_front(
+    Args&&... args) {
+  (emplace_front(std::forward<Args>(args)), ...);
+}
+
+// Allocates an empty chunk and links it in front of pos.
+template <typename T, size_t ChunkSize, typename Allocator>
+typename unrolled_list<T, ChunkSize, Allocator>::ChunkBase*
+unrolled_list<T, ChunkSize, Allocator>::CreateChunk(ChunkBase* pos) {
+  Chunk* chunk = chunk_traits::allocate(chunk_alloc_, 1);
+  new (chunk) Chunk;
+  chunk->count = 0;
+  LinkChain(pos, chunk, chunk);
+  return chunk;
+}
+
+// Destroys the elements of an unlinked chunk and frees it.
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::DestroyChunk(ChunkBase* chunk) {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    T* data = Data(chunk);
+    for (size_type i = 0; i < chunk->count; ++i) data[i].~T();
+  }
+  Chunk* full = static_cast<Chunk*>(chunk);
+  full->~Chunk();
+  chunk_traits::deallocate(chunk_alloc_, full, 1);
+}
+
+// Moves the elements from index on into a new chunk right after chunk and
+// returns it.
+template <typename T, size_t ChunkSize, typename Allocator>
+typename unrolled_list<T, ChunkSize, Allocator>::ChunkBase*
+unrolled_list<T, ChunkSize, Allocator>::SplitChunk(ChunkBase* chunk,
+                                                   size_type index) {
+  ChunkBase* upper = CreateChunk(chunk->next);
+  upper->count = chunk->count - index;
+  Relocate(Data(chunk) + index, upper->count, Data(upper));
+  chunk->count = index;
+  return upper;
+}
+
+// Keeps chunks at least half full where possible: a sparse chunk takes in
+// the whole next chunk if they fit together.
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::FoldNext(ChunkBase* chunk) {
+  ChunkBase* next = chunk->next;
+  if (chunk->count >= ChunkSize / 2 || next == &sentinel_ ||
+      chunk->count + next->count > ChunkSize) {
+    return;
+  }
+  Relocate(Data(next), next->count, Data(chunk) + chunk->count);
+  chunk->count += next->count;
+  next->count = 0;
+  UnlinkChain(next, next);
+  DestroyChunk(next);
+}
+
+// The sentinels live inside the lists, so after exchanging them the first
+// and last chunks of each ring are pointed back at their new owner.
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::SwapChunks(unrolled_list& other) {
+  std::swap(sentinel_, other.sentinel_);
+  std::swap(size_, other.size_);
+  for (unrolled_list* owner : {this, &other}) {
+    if (owner->size_ == 0) {
+      owner->ResetSentinel();
+    } else {
+      owner->sentinel_.next->prev = &owner->sentinel_;
+      owner->sentinel_.prev->next = &owner->sentinel_;
+    }
+  }
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::ResetSentinel() {
+  sentinel_.next = &sentinel_;
+  sentinel_.prev = &sentinel_;
+  sentinel_.count = 0;
+  size_ = 0;
+}
+
+// Move-constructs count elements from from to to and destroys the sources;
+// the ranges may overlap.
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::Relocate(T* from, size_type count,
+                                                      T* to) {
+  if (count == 0 || from == to) return;
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::memmove(static_cast<void*>(to), static_cast<const void*>(from),
+                 count * sizeof(T));
+  } else if (to < from) {
+    for (size_type i = 0; i < count; ++i) {
+      new (to + i) T(std::move(from[i]));
+      from[i].~T();
+    }
+  } else {
+    for (size_type i = count; i-- > 0;) {
+      new (to + i) T(std::move(from[i]));
+      from[i].~T();
+    }
+  }
+}
+
+// Links the chunks first..last, already joined through next and prev, in
+// front of pos.
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::LinkChain(ChunkBase* pos,
+                                                       ChunkBase* first,
+                                                       ChunkBase* last) {
+  ChunkBase* before = pos->prev;
+  first->prev = before;
+  last->next = pos;
+  before->next = first;
+  pos->prev = last;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void unrolled_list<T, ChunkSize, Allocator>::UnlinkChain(ChunkBase* first,
+                                                         ChunkBase* last) {
+  first->prev->next = last->next;
+  last->next->prev = first->prev;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef S21_BTREE_MAP_H
+#define S21_BTREE_MAP_H
+
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../BTree/s21_btree.h"
+
+namespace s21 {
+// Same interface as s21::map, backed by s21_BTree instead of s21_AVLTree.
+// NodeBytes sets the node size and with it the fan-out. Any insert or erase
+// invalidates iterators, including those returned by earlier inserts.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>,
+          size_t NodeBytes = 256>
+class btree_map : public s21_BTree<Key, std::pair<const Key, T>, Compare,
+                                   Allocator, NodeBytes> {
+  using tree_type =
+      s21_BTree<Key, std::pair<const Key, T>, Compare, Allocator, NodeBytes>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+
+  btree_map() : tree_type(){};
+  explicit btree_map(const Allocator &alloc) : tree_type(alloc){};
+  explicit btree_map(const Compare &comp, const Allocator &alloc = Allocator())
+      : tree_type(comp, alloc){};
+  btree_map(std::initializer_list<value_type> const &items);
+  btree_map(const btree_map &other) : tree_type(other){};
+  btree_map(btree_map &&other) noexcept : tree_type(std::move(other)){};
+  btree_map &operator=(btree_map &&other)
+      noexcept(std::is_nothrow_move_assignable_v<tree_type>);
+  btree_map &operator=(const btree_map &other);
+  ~btree_map() = default;
+
+  T &at(const Key &key);
+  T &operator[](const Key &key);
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+  void merge(btree_map &other);
+};
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          size_t NodeBytes>
+btree_map<Key, T, Compare, Allocator, NodeBytes>::btree_map(
+    const std::initializer_list<value_type> &items) {
+  for (const auto &item : items) insert(item);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          size_t NodeBytes>
+btree_map<Key, T, Compare, Allocator, NodeBytes> &
+btree_map<Key, T, Compare, Allocator, NodeBytes>::operator=(
+    btree_map &&other) noexcept(std::is_nothrow_move_assignable_v<tree_type>) {
+  tree_type::operator=(std::move(other));
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          size_t NodeBytes>
+btree_map<Key, T, Compare, Allocator, NodeBytes> &
+btree_map<Key, T, Compare, Allocator, NodeBytes>::operator=(
+    const btree_map &other) {
+  tree_type::operator=(other);
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          size_t NodeBytes>
+T &btree_map<Key, T, Compare, Allocator, NodeBytes>::at(const Key &key) {
+  auto it = tree_type::Find(key);
+  if (it == this->end())
+    throw std::out_of_range(
+        "Container does not have an element with the specified key");
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          size_t NodeBytes>
+T &btree_map<Key, T, Compare, Allocator, NodeBytes>::operator[](
+    const Key &key) {
+  auto inserted = tree_type::InsertUnique(key, std::piecewise_construct,
+                                          std::forward_as_tuple(key),
+                                          std::forward_as_tuple());
+  return inserted.first->second;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          size_t NodeBytes>
+std::pair<typename btree_map<Key, T, Compare, Allocator, NodeBytes>::iterator,
+          bool>
+btree_map<Key, T, Compare, Allocator, NodeBytes>::insert(
+    const value_type &value) {
+  return tree_type::InsertUnique(value.first, value);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          size_t NodeBytes>
+std::pair<typename btree_map<Key, T, Compare, Allocator, NodeBytes>::iterator,
+          bool>
+btree_map<Key, T, Compare, Allocator, NodeBytes>::insert(const Key &key,
+                                                         const T &obj) {
+  return tree_type::InsertUnique(key, key, obj);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          size_t NodeBytes>
+std::pair<typename btree_map<Key, T, Compare, Allocator, NodeBytes>::iterator,
+          bool>
+btree_map<Key, T, Compare, Allocator, NodeBytes>::insert_or_assign(
+    const Key &key, const T &obj) {
+  auto inserted = insert(key, obj);
+  if (!inserted.second) inserted.first->second = obj;
+  return inserted;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          size_t NodeBytes>
+template <class... Args>
+std::vector<std::pair<
+    typename btree_map<Key, T, Compare, Allocator, NodeBytes>::iterator, bool>>
+btree_map<Key, T, Compare, Allocator, NodeBytes>::insert_many(
+    Args &&...args) {
+  std::vector<std::pair<iterator, bool>> vec;
+  for (const auto &arg : {args...}) {
+    vec.push_back(insert(arg));
+  }
+  return vec;
+}
+
+// Erasing from other while walking it would invalidate the walk, so the
+// elements this map already has are collected into a new tree that then
+// replaces other.
+template <typename Key, typename T, typename Compare, typename Allocator,
+          size_t NodeBytes>
+void btree_map<Key, T, Compare, Allocator, NodeBytes>::merge(
+    btree_map &other) {
+  if (this == &other) return;
+  btree_map rest(other.key_comp(), other.get_allocator());
+  for (const auto &item : other) {
+    if (!insert(item).second) rest.insert(item);
+  }
+  other = std::move(rest);
+}
+
+}  // namespace s21
+
+#endif
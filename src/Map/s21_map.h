@@ -1,13 +1,21 @@
 #ifndef S21_MAP_H
 #define S21_MAP_H
 
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "../AVLTree/s21_avl.h"
 
 namespace s21 {
-template <typename Key, typename T>
-class map : public s21_AVLTree<Key, T> {
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class map
+    : public s21_AVLTree<Key, std::pair<const Key, T>, Compare, Allocator> {
+  using tree_type =
+      s21_AVLTree<Key, std::pair<const Key, T>, Compare, Allocator>;
+
  public:
   class MapIterator;
   class ConstMapIterator;
@@ -20,12 +28,18 @@ class map : public s21_AVLTree<Key, T> {
   using iterator = MapIterator;
   using const_iterator = ConstMapIterator;
   using size_type = size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
 
-  map() : s21_AVLTree<Key, T>(){};
+  map() : tree_type(){};
+  explicit map(const Allocator &alloc) : tree_type(alloc){};
+  explicit map(const Compare &comp, const Allocator &alloc = Allocator())
+      : tree_type(comp, alloc){};
   map(std::initializer_list<value_type> const &items);
-  map(const map &other) : s21_AVLTree<Key, T>(other){};
-  map(map &&other) noexcept : s21_AVLTree<Key, T>(std::move(other)){};
-  map &operator=(map &&other) noexcept;
+  map(const map &other) : tree_type(other){};
+  map(map &&other) noexcept : tree_type(std::move(other)){};
+  map &operator=(map &&other)
+      noexcept(std::is_nothrow_move_assignable_v<tree_type>);
   map &operator=(const map &other);
   ~map() = default;
 
@@ -35,25 +49,21 @@ class map : public s21_AVLTree<Key, T> {
   const_iterator cend() const;
   void merge(map &other);
 
-  class MapIterator : public s21_AVLTree<Key, T>::Iterator {
+  class MapIterator : public tree_type::Iterator {
    public:
     friend class map;
-    MapIterator() : s21_AVLTree<Key, T>::Iterator(){};
-    MapIterator(typename s21_AVLTree<Key, T>::Node *node,
-                typename s21_AVLTree<Key, T>::Node *past_node = nullptr)
-        : s21_AVLTree<Key, T>::Iterator(node, past_node = nullptr){};
-    value_type &operator*();
-
-   protected:
-    T &return_value();
+    MapIterator() : tree_type::Iterator(){};
+    MapIterator(typename tree_type::Node *node,
+                typename tree_type::Node *past_node = nullptr)
+        : tree_type::Iterator(node, past_node = nullptr){};
   };
 
   class ConstMapIterator : public MapIterator {
    public:
     friend class map;
     ConstMapIterator() : MapIterator(){};
-    ConstMapIterator(typename s21_AVLTree<Key, T>::Node *node,
-                     typename s21_AVLTree<Key, T>::Node *past_node = nullptr)
+    ConstMapIterator(typename tree_type::Node *node,
+                     typename tree_type::Node *past_node = nullptr)
         : MapIterator(node, past_node = nullptr){};
     const_reference operator*() const { return MapIterator::operator*(); };
   };
@@ -67,179 +77,143 @@ class map : public s21_AVLTree<Key, T> {
   std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
   void erase(iterator pos);
 
- private:
   iterator find(const Key &key);
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K &key) {
+    return iterator(tree_type::FindNode(tree_type::root_, key));
+  };
 };
 
-template <typename Key, typename T>
-map<Key, T>::map(const std::initializer_list<value_type> &items) {
+template <typename Key, typename T, typename Compare, typename Allocator>
+map<Key, T, Compare, Allocator>::map(
+    const std::initializer_list<value_type> &items) {
   for (auto i = items.begin(); i != items.end(); ++i) {
     insert(*i);
   }
 }
 
-template <typename Key, typename T>
-map<Key, T> &map<Key, T>::operator=(map &&other) noexcept {
+template <typename Key, typename T, typename Compare, typename Allocator>
+map<Key, T, Compare, Allocator> &map<Key, T, Compare, Allocator>::operator=(
+    map &&other) noexcept(std::is_nothrow_move_assignable_v<tree_type>) {
   if (this != &other) {
-    s21_AVLTree<Key, T>::operator=(std::move(other));
+    tree_type::operator=(std::move(other));
   }
   return *this;
 }
 
-template <typename Key, typename T>
-map<Key, T> &map<Key, T>::operator=(const map &other) {
+template <typename Key, typename T, typename Compare, typename Allocator>
+map<Key, T, Compare, Allocator> &map<Key, T, Compare, Allocator>::operator=(
+    const map &other) {
   if (this != &other) {
-    s21_AVLTree<Key, T>::operator=(other);
+    tree_type::operator=(other);
   }
   return *this;
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const value_type &value) {
-  return insert(value.first, value.second);
-}
-
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const Key &key, const T &obj) {
-  std::pair<iterator, bool> return_value;
-  if (s21_AVLTree<Key, T>::root_ == nullptr) {
-    s21_AVLTree<Key, T>::root_ =
-        new typename s21_AVLTree<Key, T>::Node(key, obj);
-    return_value.first = iterator(s21_AVLTree<Key, T>::root_);
-    return_value.second = true;
-  } else {
-    bool check_insert = s21_AVLTree<Key, T>::RecursiveInsert(
-        s21_AVLTree<Key, T>::root_, key, obj);
-    return_value.first = find(key);
-    return_value.second = check_insert;
-  }
-  return return_value;
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::pair<typename map<Key, T, Compare, Allocator>::iterator, bool>
+map<Key, T, Compare, Allocator>::insert(const value_type &value) {
+  auto inserted = tree_type::InsertNode(value.first, value);
+  return {iterator(inserted.first), inserted.second};
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::value_type &map<Key, T>::MapIterator::operator*() {
-  if (s21_AVLTree<Key, T>::Iterator::iter_node_ == nullptr) {
-    static value_type fake_value{};
-    return fake_value;
-  }
-  std::pair<const key_type, mapped_type> pr =
-      std::make_pair(s21_AVLTree<Key, T>::Iterator::iter_node_->key_,
-                     s21_AVLTree<Key, T>::Iterator::iter_node_->value_);
-  std::pair<const key_type, mapped_type> &ref = pr;
-  return ref;
-}
-
-template <typename Key, typename T>
-T &map<Key, T>::MapIterator::return_value() {
-  if (s21_AVLTree<Key, T>::Iterator::iter_node_ == nullptr) {
-    static T fake_value{};
-    return fake_value;
-  }
-  return s21_AVLTree<Key, T>::Iterator::iter_node_->value_;
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::pair<typename map<Key, T, Compare, Allocator>::iterator, bool>
+map<Key, T, Compare, Allocator>::insert(const Key &key, const T &obj) {
+  auto inserted = tree_type::InsertNode(key, key, obj);
+  return {iterator(inserted.first), inserted.second};
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::find(const Key &key) {
-  typename s21_AVLTree<Key, T>::Node *node =
-      s21_AVLTree<Key, T>::RecursiveFind(s21_AVLTree<Key, T>::root_, key);
-  return iterator(node);
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename map<Key, T, Compare, Allocator>::iterator
+map<Key, T, Compare, Allocator>::find(const Key &key) {
+  return iterator(tree_type::FindNode(tree_type::root_, key));
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert_or_assign(
-    const Key &key, const T &obj) {
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::pair<typename map<Key, T, Compare, Allocator>::iterator, bool>
+map<Key, T, Compare, Allocator>::insert_or_assign(const Key &key,
+                                                  const T &obj) {
   auto it = find(key);
   if (it != this->end()) {
-    erase(it);
-    auto pr = insert(key, obj);
-    pr.second = false;
-    return pr;
+    (*it).second = obj;
+    return {it, false};
   }
   return insert(key, obj);
 }
 
-template <typename Key, typename T>
+template <typename Key, typename T, typename Compare, typename Allocator>
 template <class... Args>
-std::vector<std::pair<typename map<Key, T>::iterator, bool>>
-map<Key, T>::insert_many(Args &&...args) {
-  std::vector<std::pair<typename map<Key, T>::iterator, bool>> vec;
+std::vector<std::pair<typename map<Key, T, Compare, Allocator>::iterator, bool>>
+map<Key, T, Compare, Allocator>::insert_many(Args &&...args) {
+  std::vector<std::pair<iterator, bool>> vec;
   for (const auto &arg : {args...}) {
     vec.push_back(insert(arg));
   }
   return vec;
 }
 
-template <typename Key, typename T>
-T &map<Key, T>::at(const Key &key) {
-  auto it = find(key);
-  if (it == nullptr)
+template <typename Key, typename T, typename Compare, typename Allocator>
+T &map<Key, T, Compare, Allocator>::at(const Key &key) {
+  auto *node = tree_type::FindNode(tree_type::root_, key);
+  if (node == nullptr)
     throw std::out_of_range(
         "Container does not have an element with the specified key");
-  return it.return_value();
+  return node->data_.second;
 }
 
-template <typename Key, typename T>
-T &map<Key, T>::operator[](const Key &key) {
-  auto it = find(key);
-  if (it == nullptr) {
-    auto pr = insert(std::make_pair(key, T()));
-    it = pr.first;
-  }
-  return it.return_value();
+template <typename Key, typename T, typename Compare, typename Allocator>
+T &map<Key, T, Compare, Allocator>::operator[](const Key &key) {
+  // the mapped value is default-constructed in place, and only for a new key
+  auto inserted = tree_type::InsertNode(key, std::piecewise_construct,
+                                        std::forward_as_tuple(key),
+                                        std::forward_as_tuple());
+  return inserted.first->data_.second;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::begin() {
-  return map<Key, T>::MapIterator(
-      s21_AVLTree<Key, T>::GetMin(s21_AVLTree<Key, T>::root_));
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename map<Key, T, Compare, Allocator>::iterator
+map<Key, T, Compare, Allocator>::begin() {
+  return MapIterator(tree_type::GetMin(tree_type::root_));
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::end() {
-  if (s21_AVLTree<Key, T>::root_ == nullptr) return begin();
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename map<Key, T, Compare, Allocator>::iterator
+map<Key, T, Compare, Allocator>::end() {
+  if (tree_type::root_ == nullptr) return begin();
 
-  typename s21_AVLTree<Key, T>::Node *last_node =
-      s21_AVLTree<Key, T>::GetMax(s21_AVLTree<Key, T>::root_);
+  typename tree_type::Node *last_node = tree_type::GetMax(tree_type::root_);
   MapIterator test(nullptr, last_node);
   return test;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::const_iterator map<Key, T>::cbegin() const {
-  return map<Key, T>::ConstMapIterator(
-      s21_AVLTree<Key, T>::GetMin(s21_AVLTree<Key, T>::root_));
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename map<Key, T, Compare, Allocator>::const_iterator
+map<Key, T, Compare, Allocator>::cbegin() const {
+  return ConstMapIterator(tree_type::GetMin(tree_type::root_));
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::const_iterator map<Key, T>::cend() const {
-  if (s21_AVLTree<Key, T>::root_ == nullptr) return cbegin();
+template <typename Key, typename T, typename Compare, typename Allocator>
+typename map<Key, T, Compare, Allocator>::const_iterator
+map<Key, T, Compare, Allocator>::cend() const {
+  if (tree_type::root_ == nullptr) return cbegin();
 
-  typename s21_AVLTree<Key, T>::Node *last_node =
-      s21_AVLTree<Key, T>::GetMax(s21_AVLTree<Key, T>::root_);
+  typename tree_type::Node *last_node = tree_type::GetMax(tree_type::root_);
   ConstMapIterator test(nullptr, last_node);
   return test;
 }
 
-template <typename Key, typename T>
-void map<Key, T>::merge(map &other) {
-  map const_tree(other);
-  iterator const_it = const_tree.begin();
-  for (; const_it != const_tree.end(); ++const_it) {
-    auto key = (*const_it).first;
-    auto obj = (*const_it).second;
-    std::pair<iterator, bool> pr = insert(key, obj);
-    if (pr.second) other.erase(pr.first);
-  }
+// Nodes of other whose key is not here yet are moved over without copying.
+template <typename Key, typename T, typename Compare, typename Allocator>
+void map<Key, T, Compare, Allocator>::merge(map &other) {
+  tree_type::merge(other);
 }
 
-template <typename Key, typename T>
-void map<Key, T>::erase(map::iterator pos) {
-  if (s21_AVLTree<Key, T>::root_ == nullptr || pos.iter_node_ == nullptr)
+template <typename Key, typename T, typename Compare, typename Allocator>
+void map<Key, T, Compare, Allocator>::erase(map::iterator pos) {
+  if (tree_type::root_ == nullptr || pos.iter_node_ == nullptr)
     return;
-  s21_AVLTree<Key, T>::root_ = s21_AVLTree<Key, T>::RecursiveDelete(
-      s21_AVLTree<Key, T>::root_, (*pos).first);
+  tree_type::EraseNode(pos.iter_node_);
 }
 
 }  // namespace s21
@@ -1,225 +1,194 @@
 #ifndef S21_MULTISET_H
 #define S21_MULTISET_H
 
-#include "../s21_container.h"
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "../AVLTree/s21_avl.h"
 
 namespace s21 {
 
-template <class T>
-class multiset {
+// Elements are kept in an s21_AVLTree ordered by Compare, equal ones in
+// insertion order. With a transparent Compare the lookups also accept keys
+// of other types that Compare can order against T.
+template <class T, class Compare = std::less<T>,
+          class Allocator = std::allocator<T>>
+class multiset : public s21_AVLTree<T, T, Compare, Allocator> {
+  using tree_type = s21_AVLTree<T, T, Compare, Allocator>;
+
  public:
-  using const_iterator = typename list<T>::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using const_reference = const T&;
-  using iterator = typename list<T>::iterator;
+  using iterator = typename tree_type::iterator;
   using key_type = T;
   using reference = T&;
   using size_type = size_t;
   using value_type = T;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
 
-  multiset();
+  multiset() : tree_type(){};
+  explicit multiset(const Allocator& alloc) : tree_type(alloc){};
+  explicit multiset(const Compare& comp, const Allocator& alloc = Allocator())
+      : tree_type(comp, alloc){};
   multiset(std::initializer_list<value_type> const& items);
-  multiset(const multiset& ms);
-  multiset(multiset&& ms);
-  ~multiset();
-
-  multiset& operator=(multiset& ms);
-  multiset& operator=(multiset&& ms);
+  multiset(const multiset& ms) : tree_type(ms){};
+  multiset(multiset&& ms) noexcept : tree_type(std::move(ms)){};
+  ~multiset() = default;
 
-  iterator begin();
-  iterator end();
+  multiset& operator=(const multiset& ms);
+  multiset& operator=(multiset&& ms)
+      noexcept(std::is_nothrow_move_assignable_v<tree_type>);
 
-  bool empty();
-  size_type size();
-  size_type max_size();
-
-  void clear();
   iterator insert(const value_type& value);
-  void erase(iterator pos);
+  using tree_type::erase;
   void erase(const T& value);
-  void swap(multiset& other);
   void merge(multiset& other);
 
   size_type count(const key_type& key);
   iterator find(const key_type& key);
-  bool contains(const key_type& key);
   std::pair<iterator, iterator> equal_range(const key_type& key);
   iterator lower_bound(const key_type& key);
   iterator upper_bound(const key_type& key);
 
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type count(const K& key) {
+    auto range = EqualRange(key);
+    return std::distance(range.first, range.second);
+  };
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K& key) {
+    return Find(key);
+  };
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K& key) {
+    return EqualRange(key);
+  };
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const K& key) {
+    return this->IteratorAt(tree_type::LowerBoundNode(key));
+  };
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator upper_bound(const K& key) {
+    return this->IteratorAt(tree_type::UpperBoundNode(key));
+  };
+
   template <typename... Args>
-  std::vector<std::pair<typename multiset<T>::iterator, bool>> insert_many(
-      Args&&... args);
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
 
  private:
-  list<T> data;
+  template <class K>
+  std::pair<iterator, iterator> EqualRange(const K& key);
+  template <class K>
+  iterator Find(const K& key);
 };
 
-template <class T>
-multiset<T>::multiset() : data() {}
-
-template <class T>
-multiset<T>::multiset(std::initializer_list<value_type> const& items)
-    : data(items) {
-  data.sort();
+template <class T, class Compare, class Allocator>
+multiset<T, Compare, Allocator>::multiset(
+    std::initializer_list<value_type> const& items)
+    : tree_type() {
+  for (const auto& item : items) insert(item);
 }
 
-template <class T>
-multiset<T>::multiset(const multiset& ms) : data(ms.data) {
-  data.sort();
-}
-
-template <class T>
-multiset<T>::multiset(multiset&& ms) : data(std::move(ms.data)) {
-  data.sort();
-}
-
-template <class T>
-multiset<T>::~multiset() {}
-
-template <class T>
-multiset<T>& multiset<T>::operator=(multiset<T>&& ms) {
-  if (this != &ms) {
-    data.swap(ms);
-  }
+template <class T, class Compare, class Allocator>
+multiset<T, Compare, Allocator>& multiset<T, Compare, Allocator>::operator=(
+    multiset&& ms) noexcept(std::is_nothrow_move_assignable_v<tree_type>) {
+  tree_type::operator=(std::move(ms));
   return *this;
 }
 
-template <class T>
-multiset<T>& multiset<T>::operator=(multiset<T>& ms) {
-  data.clear();
-  for (const auto& item : ms) {
-    data.push_back(item);
-  }
+template <class T, class Compare, class Allocator>
+multiset<T, Compare, Allocator>& multiset<T, Compare, Allocator>::operator=(
+    const multiset& ms) {
+  tree_type::operator=(ms);
   return *this;
 }
 
-template <class T>
-typename multiset<T>::iterator multiset<T>::begin() {
-  return data.begin();
-}
-
-template <class T>
-typename multiset<T>::iterator multiset<T>::end() {
-  return data.end();
+template <class T, class Compare, class Allocator>
+typename multiset<T, Compare, Allocator>::iterator
+multiset<T, Compare, Allocator>::insert(const value_type& value) {
+  return iterator(tree_type::InsertEqualNode(value, value));
 }
 
-template <class T>
-bool multiset<T>::empty() {
-  return data.empty();
+// Removes one element equal to value, the earliest inserted.
+template <class T, class Compare, class Allocator>
+void multiset<T, Compare, Allocator>::erase(const T& value) {
+  erase(find(value));
 }
 
-template <class T>
-typename multiset<T>::size_type multiset<T>::size() {
-  return data.size();
+// Every element of other moves over, after the equal ones already here.
+template <class T, class Compare, class Allocator>
+void multiset<T, Compare, Allocator>::merge(multiset& other) {
+  tree_type::template MergeNodes<false>(other);
 }
 
-template <class T>
-typename multiset<T>::size_type multiset<T>::max_size() {
-  return data.max_size();
+template <class T, class Compare, class Allocator>
+typename multiset<T, Compare, Allocator>::size_type
+multiset<T, Compare, Allocator>::count(const key_type& key) {
+  auto range = EqualRange(key);
+  return std::distance(range.first, range.second);
 }
 
-template <class T>
-void multiset<T>::clear() {
-  data.clear();
+template <class T, class Compare, class Allocator>
+typename multiset<T, Compare, Allocator>::iterator
+multiset<T, Compare, Allocator>::find(const key_type& key) {
+  return Find(key);
 }
 
-template <class T>
-typename multiset<T>::iterator multiset<T>::insert(const value_type& value) {
-  auto it = data.begin();
-  while (it != data.end() && *it <= value) {
-    ++it;
-  }
-
-  return data.insert(it, value);
-}
-
-template <class T>
-void multiset<T>::erase(iterator pos) {
-  data.erase(pos);
-}
-
-template <class T>
-void multiset<T>::erase(const T& value) {
-  auto it = find(value);
-  if (it != data.end()) {
-    data.erase(it);
-  }
+template <class T, class Compare, class Allocator>
+std::pair<typename multiset<T, Compare, Allocator>::iterator,
+          typename multiset<T, Compare, Allocator>::iterator>
+multiset<T, Compare, Allocator>::equal_range(const key_type& key) {
+  return EqualRange(key);
 }
 
-template <class T>
-void multiset<T>::swap(multiset& other) {
-  data.swap(other.data);
+template <class T, class Compare, class Allocator>
+typename multiset<T, Compare, Allocator>::iterator
+multiset<T, Compare, Allocator>::lower_bound(const key_type& key) {
+  return this->IteratorAt(tree_type::LowerBoundNode(key));
 }
 
-template <class T>
-void multiset<T>::merge(multiset& other) {
-  data.merge(other.data);
+template <class T, class Compare, class Allocator>
+typename multiset<T, Compare, Allocator>::iterator
+multiset<T, Compare, Allocator>::upper_bound(const key_type& key) {
+  return this->IteratorAt(tree_type::UpperBoundNode(key));
 }
 
-template <class T>
-typename multiset<T>::size_type multiset<T>::count(const key_type& key) {
-  size_type count = 0;
-  for (const auto& elem : data) {
-    if (elem == key) ++count;
-  }
-  return count;
-}
-
-template <class T>
-typename multiset<T>::iterator multiset<T>::find(const key_type& key) {
-  for (auto it = begin(); it != end(); ++it) {
-    if (*it == key) {
-      return it;
-    }
-  }
-  return end();
-}
-
-template <class T>
-bool multiset<T>::contains(const key_type& key) {
-  return find(key) != data.end();
-}
-
-template <class T>
-std::pair<typename multiset<T>::iterator, typename multiset<T>::iterator>
-multiset<T>::equal_range(const key_type& key) {
-  auto lower = lower_bound(key);
-  auto upper = lower;
-
-  while (upper != end() && !(*upper > key)) {
-    ++upper;
-  }
-  return std::make_pair(lower, upper);
-}
-
-template <typename T>
-typename multiset<T>::iterator multiset<T>::lower_bound(const key_type& key) {
-  auto it = begin();
-  while (it != end() && *it < key) {
-    ++it;
-  }
-  return it;
-}
-
-template <class T>
-typename multiset<T>::iterator multiset<T>::upper_bound(const key_type& key) {
-  auto it = begin();
-  while (it != end() && *it <= key) {
-    ++it;
-  }
-  return it;
-}
-
-template <class T>
+template <class T, class Compare, class Allocator>
 template <typename... Args>
-std::vector<std::pair<typename multiset<T>::iterator, bool>>
-multiset<T>::insert_many(Args&&... args) {
-  std::vector<std::pair<typename multiset<T>::iterator, bool>> results;
+std::vector<std::pair<typename multiset<T, Compare, Allocator>::iterator, bool>>
+multiset<T, Compare, Allocator>::insert_many(Args&&... args) {
+  std::vector<std::pair<iterator, bool>> results;
   ((results.push_back(std::make_pair(insert(std::forward<Args>(args)), true))),
    ...);
   return results;
 }
 
+// Both bounds come from a walk down the tree; counting the range is then
+// linear in the number of equal elements only.
+template <class T, class Compare, class Allocator>
+template <class K>
+std::pair<typename multiset<T, Compare, Allocator>::iterator,
+          typename multiset<T, Compare, Allocator>::iterator>
+multiset<T, Compare, Allocator>::EqualRange(const K& key) {
+  return std::make_pair(this->IteratorAt(tree_type::LowerBoundNode(key)),
+                        this->IteratorAt(tree_type::UpperBoundNode(key)));
+}
+
+// The lower bound, so the earliest inserted of several equal elements.
+template <class T, class Compare, class Allocator>
+template <class K>
+typename multiset<T, Compare, Allocator>::iterator
+multiset<T, Compare, Allocator>::Find(const K& key) {
+  auto* node = tree_type::LowerBoundNode(key);
+  if (node == nullptr || this->comp_(key, tree_type::KeyOf(node))) {
+    return this->end();
+  }
+  return iterator(node);
+}
+
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,750 @@
+#ifndef S21_CONCURRENT_QUEUE_H
+#define S21_CONCURRENT_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+// Size used to keep indices written by different threads on separate cache
+// lines.
+inline constexpr size_t kCacheLineSize = 64;
+
+// Bounded lock-free multi-producer multi-consumer FIFO. Every cell carries a
+// sequence number telling whose turn it is: a producer at position pos may
+// fill the cell when its sequence is pos, a consumer may empty it when it is
+// pos + 1. Producers and consumers only meet on the two position counters,
+// which live on their own cache lines. The capacity is rounded up to a power
+// of two and never changes.
+//
+// Elements are moved in and out of the cells, so T must be nothrow movable:
+// a cell that was claimed has to be published.
+template <class T>
+class concurrent_queue {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T>,
+                "concurrent_queue requires a nothrow movable T");
+
+  explicit concurrent_queue(size_type capacity = 1024);
+  concurrent_queue(const concurrent_queue&) = delete;
+  concurrent_queue& operator=(const concurrent_queue&) = delete;
+  ~concurrent_queue();
+
+  // Approximate while other threads are pushing or popping.
+  bool empty() const { return size() == 0; };
+  size_type size() const;
+  size_type capacity() const { return mask_ + 1; };
+
+  bool try_push(const_reference value) { return try_emplace(value); };
+  bool try_push(value_type&& value) { return try_emplace(std::move(value)); };
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  bool try_pop(reference value);
+
+  // Spin, yielding the thread, until there is room.
+  void push(const_reference value) { emplace(value); };
+  void push(value_type&& value) { emplace(std::move(value)); };
+  template <typename... Args>
+  void emplace(Args&&... args);
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+  // Claim as many consecutive cells as are ready, up to the requested count,
+  // with a single CAS. Return how many elements were transferred. When
+  // writing to out may throw, other consumers wait while pop_bulk writes.
+  template <typename ForwardIt>
+  size_type push_bulk(ForwardIt first, ForwardIt last);
+  template <typename OutputIt>
+  size_type pop_bulk(OutputIt out, size_type max_count);
+
+ private:
+  template <typename OutputIt>
+  static constexpr bool kNothrowOutput =
+      noexcept(*std::declval<OutputIt&>() = std::declval<T&&>()) &&
+      noexcept(++std::declval<OutputIt&>());
+
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* Value() { return std::launder(reinterpret_cast<T*>(storage)); };
+  };
+
+  // Set in dequeue_pos_ while PopHeld holds the front.
+  static constexpr size_type kHeld = ~(~size_type(0) >> 1);
+
+  Cell* buffer_;
+  size_type mask_;
+  alignas(kCacheLineSize) std::atomic<size_type> enqueue_pos_;
+  alignas(kCacheLineSize) std::atomic<size_type> dequeue_pos_;
+
+  bool TryPush(T& value);
+  template <typename Consume>
+  size_type PopCells(size_type max_count, Consume consume);
+  template <typename OutputIt>
+  size_type PopHeld(OutputIt& out, size_type max_count);
+  size_type LoadFront();
+  static std::ptrdiff_t Distance(size_type sequence, size_type pos) {
+    return static_cast<std::ptrdiff_t>(sequence - pos);
+  };
+};
+
+template <typename T>
+concurrent_queue<T>::concurrent_queue(size_type capacity)
+    : enqueue_pos_(0), dequeue_pos_(0) {
+  if (capacity < 2) capacity = 2;
+  if (capacity > (static_cast<size_type>(-1) >> 2) / sizeof(Cell)) {
+    throw std::length_error("Can't allocate memory of this size");
+  }
+  size_type rounded = 2;
+  while (rounded < capacity) rounded *= 2;
+  buffer_ = std::allocator<Cell>().allocate(rounded);
+  for (size_type i = 0; i < rounded; ++i) {
+    new (&buffer_[i].sequence) std::atomic<size_type>(i);
+  }
+  mask_ = rounded - 1;
+}
+
+template <typename T>
+concurrent_queue<T>::~concurrent_queue() {
+  size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+  size_type end = enqueue_pos_.load(std::memory_order_relaxed);
+  for (; pos != end; ++pos) {
+    buffer_[pos & mask_].Value()->~T();
+  }
+  for (size_type i = 0; i <= mask_; ++i) {
+    buffer_[i].sequence.~atomic();
+  }
+  std::allocator<Cell>().deallocate(buffer_, mask_ + 1);
+}
+
+template <typename T>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::size() const {
+  size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+  size_type head = dequeue_pos_.load(std::memory_order_acquire) & ~kHeld;
+  // the two loads are not atomic together: clamp a stale reading
+  std::ptrdiff_t count = Distance(tail, head);
+  if (count < 0) return 0;
+  if (static_cast<size_type>(count) > capacity()) return capacity();
+  return static_cast<size_type>(count);
+}
+
+template <typename T>
+template <typename... Args>
+bool concurrent_queue<T>::try_emplace(Args&&... args) {
+  // built up front so that a throwing constructor never strands a cell
+  T value(std::forward<Args>(args)...);
+  return TryPush(value);
+}
+
+template <typename T>
+template <typename... Args>
+void concurrent_queue<T>::emplace(Args&&... args) {
+  T value(std::forward<Args>(args)...);
+  while (!TryPush(value)) {
+    std::this_thread::yield();
+  }
+}
+
+// Moves value into the queue if there is room, otherwise leaves it alone.
+template <typename T>
+bool concurrent_queue<T>::TryPush(T& value) {
+  size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  for (;;) {
+    cell = &buffer_[pos & mask_];
+    size_type sequence = cell->sequence.load(std::memory_order_acquire);
+    std::ptrdiff_t diff = Distance(sequence, pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  new (cell->storage) T(std::move(value));
+  cell->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+bool concurrent_queue<T>::try_pop(reference value) {
+  size_type pos = LoadFront();
+  Cell* cell;
+  for (;;) {
+    if ((pos & kHeld) != 0) pos = LoadFront();
+    cell = &buffer_[pos & mask_];
+    size_type sequence = cell->sequence.load(std::memory_order_acquire);
+    std::ptrdiff_t diff = Distance(sequence, pos + 1);
+    if (diff == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_acquire,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  T* item = cell->Value();
+  value = std::move(*item);
+  item->~T();
+  cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+template <typename... Args>
+void concurrent_queue<T>::insert_many_back(Args&&... args) {
+  (emplace(std::forward<Args>(args)), ...);
+}
+
+// Claimed cells must be published, so nothing that may throw runs between
+// the claim and the stores. When building a T from *first may throw, up to
+// capacity() elements are copied into a local buffer first and moved into
+// the cells from there.
+template <typename T>
+template <typename ForwardIt>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::push_bulk(
+    ForwardIt first, ForwardIt last) {
+  using source = typename std::iterator_traits<ForwardIt>::reference;
+  size_type wanted = static_cast<size_type>(std::distance(first, last));
+  if (wanted == 0) return 0;
+  if constexpr (!std::is_nothrow_constructible_v<T, source>) {
+    std::vector<T> staged;
+    staged.reserve(std::min(wanted, capacity()));
+    for (; staged.size() != staged.capacity() && first != last; ++first) {
+      staged.emplace_back(*first);
+    }
+    return push_bulk(std::make_move_iterator(staged.begin()),
+                     std::make_move_iterator(staged.end()));
+  }
+  size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+  size_type claimed;
+  for (;;) {
+    claimed = 0;
+    while (claimed < wanted &&
+           buffer_[(pos + claimed) & mask_].sequence.load(
+               std::memory_order_acquire) == pos + claimed) {
+      ++claimed;
+    }
+    if (claimed == 0) {
+      size_type sequence =
+          buffer_[pos & mask_].sequence.load(std::memory_order_acquire);
+      if (Distance(sequence, pos) < 0) return 0;
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    } else if (enqueue_pos_.compare_exchange_weak(pos, pos + claimed,
+                                                  std::memory_order_relaxed)) {
+      break;
+    }
+  }
+  for (size_type i = 0; i < claimed; ++i, ++first) {
+    Cell& cell = buffer_[(pos + i) & mask_];
+    new (cell.storage) T(*first);
+    cell.sequence.store(pos + i + 1, std::memory_order_release);
+  }
+  return claimed;
+}
+
+// Elements go to out straight from their cells. An output that may throw is
+// written to by PopHeld instead, so nothing is lost when it does.
+template <typename T>
+template <typename OutputIt>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::pop_bulk(
+    OutputIt out, size_type max_count) {
+  if (max_count == 0) return 0;
+  if constexpr (kNothrowOutput<OutputIt>) {
+    return PopCells(max_count, [&out](T&& item) noexcept {
+      *out = std::move(item);
+      ++out;
+    });
+  } else {
+    return PopHeld(out, max_count);
+  }
+}
+
+// Claims up to max_count ready cells with one CAS and hands each element, as
+// an rvalue, to consume, which must not throw.
+template <typename T>
+template <typename Consume>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::PopCells(
+    size_type max_count, Consume consume) {
+  size_type pos = LoadFront();
+  size_type claimed;
+  for (;;) {
+    if ((pos & kHeld) != 0) pos = LoadFront();
+    claimed = 0;
+    while (claimed < max_count &&
+           buffer_[(pos + claimed) & mask_].sequence.load(
+               std::memory_order_acquire) == pos + claimed + 1) {
+      ++claimed;
+    }
+    if (claimed == 0) {
+      size_type sequence =
+          buffer_[pos & mask_].sequence.load(std::memory_order_acquire);
+      if (Distance(sequence, pos + 1) < 0) return 0;
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    } else if (dequeue_pos_.compare_exchange_weak(pos, pos + claimed,
+                                                  std::memory_order_acquire,
+                                                  std::memory_order_relaxed)) {
+      break;
+    }
+  }
+  for (size_type i = 0; i < claimed; ++i) {
+    Cell& cell = buffer_[(pos + i) & mask_];
+    T* item = cell.Value();
+    consume(std::move(*item));
+    item->~T();
+    cell.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+  }
+  return claimed;
+}
+
+// Holds the front of the queue while writing to out: other consumers wait
+// until it is released, so an element whose write throws can stay where it
+// is. The write must leave the element as it was when it throws, as
+// inserters into the standard containers do.
+template <typename T>
+template <typename OutputIt>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::PopHeld(
+    OutputIt& out, size_type max_count) {
+  size_type pos = LoadFront();
+  for (;;) {
+    size_type sequence =
+        buffer_[pos & mask_].sequence.load(std::memory_order_acquire);
+    std::ptrdiff_t diff = Distance(sequence, pos + 1);
+    if (diff < 0) return 0;
+    if (diff > 0) {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    } else if (dequeue_pos_.compare_exchange_weak(pos, pos | kHeld,
+                                                  std::memory_order_acquire,
+                                                  std::memory_order_relaxed)) {
+      break;
+    }
+    if ((pos & kHeld) != 0) pos = LoadFront();
+  }
+  size_type count = 0;
+  try {
+    for (; count < max_count; ++count) {
+      Cell& cell = buffer_[(pos + count) & mask_];
+      if (cell.sequence.load(std::memory_order_acquire) != pos + count + 1) {
+        break;
+      }
+      T* item = cell.Value();
+      *out = std::move(*item);
+      ++out;
+      item->~T();
+      cell.sequence.store(pos + count + mask_ + 1, std::memory_order_release);
+    }
+  } catch (...) {
+    // release the front; the failed element is still on it
+    dequeue_pos_.store(pos + count, std::memory_order_release);
+    throw;
+  }
+  dequeue_pos_.store(pos + count, std::memory_order_release);
+  return count;
+}
+
+// Position of the front cell, once no consumer holds it.
+template <typename T>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::LoadFront() {
+  size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+  while ((pos & kHeld) != 0) {
+    std::this_thread::yield();
+    pos = dequeue_pos_.load(std::memory_order_relaxed);
+  }
+  return pos;
+}
+
+// Unbounded lock-free MPMC FIFO made of fixed-size segments. Producers and
+// consumers take a slot of the current segment with one fetch_add; when a
+// segment runs out a new one is linked behind it. Each slot is used once, so
+// the only race left is a consumer arriving before the producer it was
+// matched with: it marks the slot taken and the producer retries elsewhere.
+//
+// Segments unlinked from the head may still be read by operations that
+// loaded them earlier. Every operation publishes the segment it works on in
+// a hazard slot of its own; unlinked segments are parked on a retired list
+// and freed by the next scan that finds them in no slot. At most
+// kHazardSlots segments can be protected at once, so the retired list stays
+// that short however busy the queue is.
+template <class T, size_t SegmentSize = 1024>
+class unbounded_concurrent_queue {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T>,
+                "unbounded_concurrent_queue requires a nothrow movable T");
+  static_assert(SegmentSize > 0, "SegmentSize must be positive");
+
+  // Operations that can run at once; further threads wait for a free slot.
+  static constexpr size_type kHazardSlots = 64;
+
+  unbounded_concurrent_queue();
+  unbounded_concurrent_queue(const unbounded_concurrent_queue&) = delete;
+  unbounded_concurrent_queue& operator=(const unbounded_concurrent_queue&) =
+      delete;
+  ~unbounded_concurrent_queue();
+
+  // Approximate while other threads are pushing or popping.
+  bool empty() const { return size() == 0; };
+  size_type size() const;
+
+  // Never fails, the queue grows instead; provided for symmetry with
+  // concurrent_queue.
+  bool try_push(const_reference value) {
+    emplace(value);
+    return true;
+  };
+  bool try_push(value_type&& value) {
+    emplace(std::move(value));
+    return true;
+  };
+  bool try_pop(reference value) {
+    return PopWith([&value](T&& item) noexcept { value = std::move(item); });
+  };
+
+  void push(const_reference value) { emplace(value); };
+  void push(value_type&& value) { emplace(std::move(value)); };
+  template <typename... Args>
+  void emplace(Args&&... args);
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+  template <typename InputIt>
+  size_type push_bulk(InputIt first, InputIt last);
+  template <typename OutputIt>
+  size_type pop_bulk(OutputIt out, size_type max_count);
+
+  // Segments unlinked but not freed yet, as an operation may still read them.
+  size_type retired_segments() const {
+    return retired_count_.load(std::memory_order_relaxed);
+  };
+
+ private:
+  template <typename OutputIt>
+  static constexpr bool kNothrowOutput =
+      noexcept(*std::declval<OutputIt&>() = std::declval<T&&>()) &&
+      noexcept(++std::declval<OutputIt&>());
+
+  enum SlotState : int { kEmpty, kReady, kTaken };
+
+  struct Slot {
+    std::atomic<int> state{kEmpty};
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* Value() { return std::launder(reinterpret_cast<T*>(storage)); };
+  };
+
+  struct Segment {
+    alignas(kCacheLineSize) std::atomic<size_type> enqueue_idx{0};
+    alignas(kCacheLineSize) std::atomic<size_type> dequeue_idx{0};
+    alignas(kCacheLineSize) std::atomic<Segment*> next{nullptr};
+    Segment* retired_next = nullptr;
+    Slot slots[SegmentSize];
+  };
+
+  struct alignas(kCacheLineSize) HazardSlot {
+    std::atomic<bool> owned{false};
+    std::atomic<Segment*> segment{nullptr};
+  };
+
+  // Holds a hazard slot for the lifetime of one operation.
+  class HazardGuard {
+   public:
+    explicit HazardGuard(unbounded_concurrent_queue* queue)
+        : slot_(queue->AcquireSlot()){};
+    ~HazardGuard() {
+      slot_->segment.store(nullptr, std::memory_order_release);
+      slot_->owned.store(false, std::memory_order_release);
+    };
+
+    // Loads source and publishes the segment before using it; the second
+    // load makes sure it was still linked once the slot showed it.
+    Segment* Protect(const std::atomic<Segment*>& source) {
+      Segment* segment = source.load(std::memory_order_acquire);
+      for (;;) {
+        slot_->segment.store(segment);
+        Segment* current = source.load();
+        if (current == segment) return segment;
+        segment = current;
+      }
+    };
+
+   private:
+    HazardSlot* slot_;
+  };
+
+  alignas(kCacheLineSize) std::atomic<Segment*> head_;
+  alignas(kCacheLineSize) std::atomic<Segment*> tail_;
+  alignas(kCacheLineSize) std::atomic<Segment*> retired_;
+  std::atomic<size_type> retired_count_;
+  alignas(kCacheLineSize) std::atomic<size_type> pushed_;
+  alignas(kCacheLineSize) std::atomic<size_type> popped_;
+  HazardSlot hazards_[kHazardSlots];
+
+  template <typename Sink>
+  bool PopWith(Sink sink);
+  HazardSlot* AcquireSlot();
+  void Retire(Segment* segment);
+  void PushRetired(Segment* segment);
+  static void DestroySegment(Segment* segment);
+};
+
+template <typename T, size_t SegmentSize>
+unbounded_concurrent_queue<T, SegmentSize>::unbounded_concurrent_queue()
+    : retired_(nullptr), retired_count_(0), pushed_(0), popped_(0) {
+  Segment* segment = new Segment;
+  head_.store(segment, std::memory_order_relaxed);
+  tail_.store(segment, std::memory_order_relaxed);
+}
+
+template <typename T, size_t SegmentSize>
+unbounded_concurrent_queue<T, SegmentSize>::~unbounded_concurrent_queue() {
+  Segment* segment = head_.load(std::memory_order_relaxed);
+  while (segment != nullptr) {
+    Segment* next = segment->next.load(std::memory_order_relaxed);
+    DestroySegment(segment);
+    segment = next;
+  }
+  segment = retired_.load(std::memory_order_relaxed);
+  while (segment != nullptr) {
+    Segment* next = segment->retired_next;
+    delete segment;
+    segment = next;
+  }
+}
+
+template <typename T, size_t SegmentSize>
+typename unbounded_concurrent_queue<T, SegmentSize>::size_type
+unbounded_concurrent_queue<T, SegmentSize>::size() const {
+  size_type popped = popped_.load(std::memory_order_acquire);
+  size_type pushed = pushed_.load(std::memory_order_acquire);
+  return pushed > popped ? pushed - popped : 0;
+}
+
+template <typename T, size_t SegmentSize>
+template <typename... Args>
+void unbounded_concurrent_queue<T, SegmentSize>::emplace(Args&&... args) {
+  T value(std::forward<Args>(args)...);
+  HazardGuard guard(this);
+  for (;;) {
+    Segment* tail = guard.Protect(tail_);
+    size_type idx = tail->enqueue_idx.fetch_add(1);
+    if (idx < SegmentSize) {
+      Slot& slot = tail->slots[idx];
+      new (slot.storage) T(std::move(value));
+      int expected = kEmpty;
+      if (slot.state.compare_exchange_strong(expected, kReady,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+        pushed_.fetch_add(1, std::memory_order_release);
+        return;
+      }
+      // a consumer gave up on this slot before we filled it
+      value = std::move(*slot.Value());
+      slot.Value()->~T();
+      continue;
+    }
+    Segment* next = tail->next.load(std::memory_order_acquire);
+    if (next == nullptr) {
+      Segment* fresh = new Segment;
+      if (tail->next.compare_exchange_strong(next, fresh)) {
+        next = fresh;
+      } else {
+        delete fresh;
+      }
+    }
+    tail_.compare_exchange_strong(tail, next);
+  }
+}
+
+// Hands the front element, as an rvalue, to sink, which must not throw.
+template <typename T, size_t SegmentSize>
+template <typename Sink>
+bool unbounded_concurrent_queue<T, SegmentSize>::PopWith(Sink sink) {
+  static_assert(std::is_nothrow_invocable_v<Sink&, T&&>,
+                "PopWith needs a nothrow sink");
+  HazardGuard guard(this);
+  for (;;) {
+    Segment* head = guard.Protect(head_);
+    size_type dequeue = head->dequeue_idx.load();
+    if (dequeue < SegmentSize && dequeue >= head->enqueue_idx.load()) {
+      return false;
+    }
+    size_type idx = head->dequeue_idx.fetch_add(1);
+    if (idx < SegmentSize) {
+      Slot& slot = head->slots[idx];
+      if (slot.state.exchange(kTaken, std::memory_order_acq_rel) == kReady) {
+        T* item = slot.Value();
+        sink(std::move(*item));
+        item->~T();
+        popped_.fetch_add(1, std::memory_order_release);
+        return true;
+      }
+      continue;
+    }
+    Segment* next = head->next.load(std::memory_order_acquire);
+    if (next == nullptr) return false;
+    if (head_.compare_exchange_strong(head, next)) {
+      // move the tail past the segment first, so no new operation can
+      // reach it once it is retired
+      Segment* expected = head;
+      tail_.compare_exchange_strong(expected, next);
+      Retire(head);
+    }
+  }
+}
+
+template <typename T, size_t SegmentSize>
+template <typename... Args>
+void unbounded_concurrent_queue<T, SegmentSize>::insert_many_back(
+    Args&&... args) {
+  (emplace(std::forward<Args>(args)), ...);
+}
+
+template <typename T, size_t SegmentSize>
+template <typename InputIt>
+typename unbounded_concurrent_queue<T, SegmentSize>::size_type
+unbounded_concurrent_queue<T, SegmentSize>::push_bulk(InputIt first,
+                                                      InputIt last) {
+  size_type count = 0;
+  for (; first != last; ++first, ++count) {
+    emplace(*first);
+  }
+  return count;
+}
+
+// A slot cannot be handed out twice, so when writing to out may throw each
+// element is taken out of the queue before it is written. If the write fails
+// and leaves the element as it was, the element is pushed again at the back.
+template <typename T, size_t SegmentSize>
+template <typename OutputIt>
+typename unbounded_concurrent_queue<T, SegmentSize>::size_type
+unbounded_concurrent_queue<T, SegmentSize>::pop_bulk(OutputIt out,
+                                                     size_type max_count) {
+  size_type count = 0;
+  for (; count < max_count; ++count) {
+    if constexpr (kNothrowOutput<OutputIt>) {
+      if (!PopWith([&out](T&& item) noexcept {
+            *out = std::move(item);
+            ++out;
+          })) {
+        break;
+      }
+    } else {
+      std::optional<T> item;
+      if (!PopWith([&item](T&& value) noexcept {
+            item.emplace(std::move(value));
+          })) {
+        break;
+      }
+      try {
+        *out = std::move(*item);
+        ++out;
+      } catch (...) {
+        emplace(std::move(*item));
+        throw;
+      }
+    }
+  }
+  return count;
+}
+
+// Slots are tried starting from one picked by the thread id, so a thread
+// normally finds the same free slot, on a cache line of its own, every time.
+template <typename T, size_t SegmentSize>
+typename unbounded_concurrent_queue<T, SegmentSize>::HazardSlot*
+unbounded_concurrent_queue<T, SegmentSize>::AcquireSlot() {
+  unsigned long long id =
+      std::hash<std::thread::id>()(std::this_thread::get_id());
+  // thread ids tend to be aligned addresses: mix the bits before reducing
+  size_type start = static_cast<size_type>((id * 0x9E3779B97F4A7C15ULL) >> 40);
+  for (size_type i = 0;; ++i) {
+    HazardSlot& slot = hazards_[(start + i) % kHazardSlots];
+    if (!slot.owned.load(std::memory_order_relaxed) &&
+        !slot.owned.exchange(true, std::memory_order_acquire)) {
+      return &slot;
+    }
+    if (i % kHazardSlots == kHazardSlots - 1) std::this_thread::yield();
+  }
+}
+
+// Parks an unlinked segment, then frees every retired segment that no hazard
+// slot shows. The rest go back on the list for the next scan.
+template <typename T, size_t SegmentSize>
+void unbounded_concurrent_queue<T, SegmentSize>::Retire(Segment* segment) {
+  retired_count_.fetch_add(1, std::memory_order_relaxed);
+  PushRetired(segment);
+  Segment* list = retired_.exchange(nullptr);
+  if (list == nullptr) return;
+  Segment* in_use[kHazardSlots];
+  size_type in_use_count = 0;
+  for (HazardSlot& slot : hazards_) {
+    Segment* hazard = slot.segment.load();
+    if (hazard != nullptr) in_use[in_use_count++] = hazard;
+  }
+  while (list != nullptr) {
+    Segment* next = list->retired_next;
+    if (std::find(in_use, in_use + in_use_count, list) ==
+        in_use + in_use_count) {
+      delete list;
+      retired_count_.fetch_sub(1, std::memory_order_relaxed);
+    } else {
+      PushRetired(list);
+    }
+    list = next;
+  }
+}
+
+template <typename T, size_t SegmentSize>
+void unbounded_concurrent_queue<T, SegmentSize>::PushRetired(
+    Segment* segment) {
+  Segment* top = retired_.load(std::memory_order_relaxed);
+  do {
+    segment->retired_next = top;
+  } while (!retired_.compare_exchange_weak(top, segment));
+}
+
+// Destroys the elements still published in a live segment and frees it.
+template <typename T, size_t SegmentSize>
+void unbounded_concurrent_queue<T, SegmentSize>::DestroySegment(
+    Segment* segment) {
+  for (size_type i = 0; i < SegmentSize; ++i) {
+    if (segment->slots[i].state.load(std::memory_order_relaxed) == kReady) {
+      segment->slots[i].Value()->~T();
+    }
+  }
+  delete segment;
+}
+
+}  // namespace s21
+
+#endif
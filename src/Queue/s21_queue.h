@@ -2,48 +2,63 @@
 #define S21_QUEUE_H
 
 #include "../s21_container.h"
+#include "s21_ring_buffer.h"
 
 namespace s21 {
-template <class T>
+// FIFO adapter in the manner of std::queue. Container must provide front,
+// back, push_back, emplace_back, pop_front, insert_many_back, size, empty,
+// clear and swap; ring_buffer (the default) and list both do.
+template <class T, class Container = ring_buffer<T>>
 class queue {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
 
-  queue() : list_(){};
-  queue(std::initializer_list<value_type> const& items) : list_(items){};
-  queue(const queue& q) : list_(q.list_){};
-  queue(queue&& q) : list_(std::move(q.list_)){};
+  queue() : container_(){};
+  explicit queue(const Container& container) : container_(container){};
+  explicit queue(Container&& container) : container_(std::move(container)){};
+  queue(std::initializer_list<value_type> const& items) : container_(items){};
+  queue(const queue& q) : container_(q.container_){};
+  queue(queue&& q) : container_(std::move(q.container_)){};
 
   ~queue(){};
 
   queue& operator=(queue&& q);
 
-  const_reference front() { return list_.front(); };
-  const_reference back() { return list_.back(); };
+  const_reference front() { return container_.front(); };
+  const_reference back() { return container_.back(); };
 
-  bool empty() { return list_.empty(); };
-  size_type size() { return list_.size(); };
+  bool empty() { return container_.empty(); };
+  size_type size() { return container_.size(); };
+  // Only available when Container has the corresponding method.
+  void reserve(size_type n) { container_.reserve(n); };
+  void reserve_nodes(size_type n) { container_.reserve_nodes(n); };
 
-  void push(const_reference value) { list_.push_back(value); };
-  void pop() { list_.pop_front(); };
-  void swap(queue& other) { list_.swap(other.list_); };
+  void push(const_reference value) { container_.push_back(value); };
+  void push(value_type&& value) { container_.push_back(std::move(value)); };
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    container_.emplace_back(std::forward<Args>(args)...);
+  };
+  void pop() { container_.pop_front(); };
+  void swap(queue& other) { container_.swap(other.container_); };
 
   template <typename... Args>
   void insert_many_back(Args&&... args) {
-    list_.insert_many_back(std::forward<Args>(args)...);
+    container_.insert_many_back(std::forward<Args>(args)...);
   };
 
-  void clear() { list_.clear(); }
+  void clear() { container_.clear(); }
 
  private:
-  list<T> list_;
+  Container container_;
 };
 
-template <class T>
-queue<T>& queue<T>::operator=(queue<T>&& q) {
+template <class T, class Container>
+queue<T, Container>& queue<T, Container>::operator=(queue&& q) {
   if (this != &q) {
     swap(q);
   }
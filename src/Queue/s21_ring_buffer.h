@@ -0,0 +1,286 @@
+#ifndef S21_RING_BUFFER_H
+#define S21_RING_BUFFER_H
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Growable circular buffer with a power-of-two capacity, so wrapping around
+// is a mask instead of a division. Elements are pushed at the back and popped
+// at the front; once the buffer is large enough neither allocates. Used as
+// the default container of queue.
+template <class T, class Allocator = std::allocator<T>>
+class ring_buffer {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  static_assert(std::is_same_v<typename Allocator::value_type, T>,
+                "Allocator::value_type must be T");
+
+  ring_buffer() : ring_buffer(Allocator()){};
+  explicit ring_buffer(const Allocator& alloc)
+      : alloc_(alloc), data_(nullptr), capacity_(0), head_(0), size_(0){};
+  ring_buffer(std::initializer_list<value_type> const& items);
+  ring_buffer(const ring_buffer& other);
+  ring_buffer(ring_buffer&& other);
+
+  ~ring_buffer();
+
+  ring_buffer& operator=(ring_buffer&& other);
+
+  allocator_type get_allocator() { return alloc_; };
+
+  reference front() { return data_[head_]; };
+  reference back() { return *Slot(size_ - 1); };
+  reference operator[](size_type pos) { return *Slot(pos); };
+  reference at(size_type pos);
+
+  bool empty() { return size_ == 0; };
+  size_type size() { return size_; };
+  size_type capacity() { return capacity_; };
+  size_type max_size();
+  void reserve(size_type size);
+
+  void clear();
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  void pop_front();
+  void swap(ring_buffer& other);
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static constexpr size_type kMinCapacity = 8;
+
+  Allocator alloc_;
+  T* data_;
+  size_type capacity_;
+  size_type head_;
+  size_type size_;
+
+  T* Slot(size_type pos) { return data_ + ((head_ + pos) & (capacity_ - 1)); }
+  void Grow(size_type required);
+  void Release();
+  void SwapStorage(ring_buffer& other);
+};
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(
+    std::initializer_list<value_type> const& items)
+    : ring_buffer() {
+  reserve(items.size());
+  for (const auto& item : items) {
+    emplace_back(item);
+  }
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(const ring_buffer& other)
+    : ring_buffer(
+          alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+  reserve(other.size_);
+  for (size_type i = 0; i < other.size_; ++i) {
+    emplace_back(other.data_[(other.head_ + i) & (other.capacity_ - 1)]);
+  }
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(ring_buffer&& other)
+    : ring_buffer(std::move(other.alloc_)) {
+  SwapStorage(other);
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::~ring_buffer() {
+  Release();
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>& ring_buffer<T, Allocator>::operator=(
+    ring_buffer&& other) {
+  if (this == &other) return *this;
+  Release();
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    alloc_ = std::move(other.alloc_);
+    SwapStorage(other);
+  } else if (alloc_ == other.alloc_) {
+    SwapStorage(other);
+  } else {
+    reserve(other.size_);
+    for (size_type i = 0; i < other.size_; ++i) {
+      emplace_back(std::move(other[i]));
+    }
+    other.clear();
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::reference ring_buffer<T, Allocator>::at(
+    size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out range");
+  }
+  return *Slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::size_type
+ring_buffer<T, Allocator>::max_size() {
+  // the largest power of two that still fits in the address space
+  size_type limit = std::numeric_limits<size_type>::max() / sizeof(T);
+  size_type power = 1;
+  while (power <= limit / 2) power *= 2;
+  return power;
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::reserve(size_type size) {
+  if (size > capacity_) {
+    Grow(size);
+  }
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::clear() {
+  while (size_ != 0) {
+    pop_front();
+  }
+  head_ = 0;
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::pop_front() {
+  if (size_ == 0) return;
+  alloc_traits::destroy(alloc_, data_ + head_);
+  head_ = (head_ + 1) & (capacity_ - 1);
+  --size_;
+}
+
+// Allocators are exchanged only when they propagate on swap; otherwise they
+// must compare equal.
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::swap(ring_buffer& other) {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+  SwapStorage(other);
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename ring_buffer<T, Allocator>::reference
+ring_buffer<T, Allocator>::emplace_back(Args&&... args) {
+  if (size_ == capacity_) {
+    // build the element first: args may refer to one of ours
+    T value(std::forward<Args>(args)...);
+    Grow(size_ + 1);
+    alloc_traits::construct(alloc_, Slot(size_), std::move(value));
+  } else {
+    alloc_traits::construct(alloc_, Slot(size_), std::forward<Args>(args)...);
+  }
+  ++size_;
+  return back();
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+void ring_buffer<T, Allocator>::insert_many_back(Args&&... args) {
+  reserve(size_ + sizeof...(Args));
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+// Moves the elements, unwrapped, to the front of a power-of-two buffer of at
+// least required slots. On exception the buffer is left untouched.
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::Grow(size_type required) {
+  if (required > max_size()) {
+    throw std::length_error("Can't allocate memory of this size");
+  }
+  size_type new_capacity = capacity_ == 0 ? kMinCapacity : capacity_ * 2;
+  while (new_capacity < required) new_capacity *= 2;
+  T* new_data = alloc_traits::allocate(alloc_, new_capacity);
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    size_type first = std::min(size_, capacity_ - head_);
+    if (first != 0) {
+      std::memcpy(static_cast<void*>(new_data),
+                  static_cast<const void*>(data_ + head_), first * sizeof(T));
+      std::memcpy(static_cast<void*>(new_data + first),
+                  static_cast<const void*>(data_), (size_ - first) * sizeof(T));
+    }
+  } else {
+    size_type i = 0;
+    try {
+      for (; i < size_; ++i) {
+        alloc_traits::construct(alloc_, new_data + i,
+                                std::move_if_noexcept(*Slot(i)));
+      }
+    } catch (...) {
+      for (size_type j = 0; j < i; ++j) {
+        alloc_traits::destroy(alloc_, new_data + j);
+      }
+      alloc_traits::deallocate(alloc_, new_data, new_capacity);
+      throw;
+    }
+  }
+  size_type size = size_;
+  Release();
+  data_ = new_data;
+  capacity_ = new_capacity;
+  size_ = size;
+}
+
+// Destroys the elements and frees the buffer.
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::Release() {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (size_type i = 0; i < size_; ++i) {
+      alloc_traits::destroy(alloc_, Slot(i));
+    }
+  }
+  if (data_ != nullptr) {
+    alloc_traits::deallocate(alloc_, data_, capacity_);
+  }
+  data_ = nullptr;
+  capacity_ = 0;
+  head_ = 0;
+  size_ = 0;
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::SwapStorage(ring_buffer& other) {
+  std::swap(data_, other.data_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+}
+
+}  // namespace s21
+
+#endif
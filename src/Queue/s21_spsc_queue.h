@@ -0,0 +1,212 @@
+#ifndef S21_SPSC_QUEUE_H
+#define S21_SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "s21_concurrent_queue.h"
+
+namespace s21 {
+// Wait-free FIFO for exactly one producer thread and one consumer thread.
+// Each side owns one index and only publishes it with a release store, so
+// no operation needs a CAS. Each side also keeps a private copy of the other
+// side's index and reloads the shared one only when the copy says the queue
+// is full (or empty), which keeps the two cache lines from bouncing on every
+// call. Capacity must be a power of two; the cells are stored inline.
+//
+// push/try_push/push_bulk may only be called from the producer thread,
+// front/pop/try_pop/pop_bulk only from the consumer thread.
+template <class T, size_t Capacity>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "Capacity must be a power of two");
+  static_assert(alignof(T) <= kCacheLineSize, "T is over-aligned");
+
+  spsc_queue() : head_(0), cached_tail_(0), tail_(0), cached_head_(0){};
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+  ~spsc_queue();
+
+  // Approximate unless called from one of the two owning threads.
+  bool empty() const { return size() == 0; };
+  size_type size() const;
+  static constexpr size_type capacity() { return Capacity; };
+
+  bool try_push(const_reference value) { return try_emplace(value); };
+  bool try_push(value_type&& value) { return try_emplace(std::move(value)); };
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  // Spin, yielding the thread, until there is room.
+  void push(const_reference value) { emplace(value); };
+  void push(value_type&& value) { emplace(std::move(value)); };
+  template <typename... Args>
+  void emplace(Args&&... args);
+
+  // The front element stays in place until pop; the queue must not be empty.
+  reference front() { return *Cell(head_.load(std::memory_order_relaxed)); };
+  void pop();
+  bool try_pop(reference value);
+
+  // Transfer as many elements as fit (or are available), up to the requested
+  // count, publishing the index once. Return how many were transferred.
+  template <typename InputIt>
+  size_type push_bulk(InputIt first, InputIt last);
+  template <typename OutputIt>
+  size_type pop_bulk(OutputIt out, size_type max_count);
+
+ private:
+  static constexpr size_type kMask = Capacity - 1;
+
+  // consumer side
+  alignas(kCacheLineSize) std::atomic<size_type> head_;
+  size_type cached_tail_;
+  // producer side
+  alignas(kCacheLineSize) std::atomic<size_type> tail_;
+  size_type cached_head_;
+  alignas(kCacheLineSize) unsigned char storage_[Capacity * sizeof(T)];
+
+  void* RawCell(size_type pos) { return storage_ + (pos & kMask) * sizeof(T); };
+  T* Cell(size_type pos) {
+    return std::launder(reinterpret_cast<T*>(RawCell(pos)));
+  };
+  size_type FreeCells(size_type tail);
+  size_type ReadyCells(size_type head);
+};
+
+template <typename T, size_t Capacity>
+spsc_queue<T, Capacity>::~spsc_queue() {
+  size_type head = head_.load(std::memory_order_relaxed);
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  for (; head != tail; ++head) {
+    Cell(head)->~T();
+  }
+}
+
+template <typename T, size_t Capacity>
+typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::size()
+    const {
+  size_type head = head_.load(std::memory_order_acquire);
+  size_type tail = tail_.load(std::memory_order_acquire);
+  size_type count = tail - head;
+  // head may be stale by the time tail is read
+  return count > Capacity ? Capacity : count;
+}
+
+template <typename T, size_t Capacity>
+template <typename... Args>
+bool spsc_queue<T, Capacity>::try_emplace(Args&&... args) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (FreeCells(tail) == 0) return false;
+  new (RawCell(tail)) T(std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T, size_t Capacity>
+template <typename... Args>
+void spsc_queue<T, Capacity>::emplace(Args&&... args) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  while (FreeCells(tail) == 0) {
+    std::this_thread::yield();
+  }
+  new (RawCell(tail)) T(std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+}
+
+template <typename T, size_t Capacity>
+void spsc_queue<T, Capacity>::pop() {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (ReadyCells(head) == 0) return;
+  Cell(head)->~T();
+  head_.store(head + 1, std::memory_order_release);
+}
+
+template <typename T, size_t Capacity>
+bool spsc_queue<T, Capacity>::try_pop(reference value) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (ReadyCells(head) == 0) return false;
+  T* item = Cell(head);
+  value = std::move(*item);
+  item->~T();
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T, size_t Capacity>
+template <typename InputIt>
+typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::push_bulk(
+    InputIt first, InputIt last) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  size_type room = FreeCells(tail);
+  size_type count = 0;
+  try {
+    for (; count < room && first != last; ++count, ++first) {
+      new (RawCell(tail + count)) T(*first);
+    }
+  } catch (...) {
+    // publish what was built so far, then report the failure
+    tail_.store(tail + count, std::memory_order_release);
+    throw;
+  }
+  tail_.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+template <typename T, size_t Capacity>
+template <typename OutputIt>
+typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::pop_bulk(
+    OutputIt out, size_type max_count) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  size_type ready = ReadyCells(head);
+  size_type count = 0;
+  try {
+    for (; count < ready && count < max_count; ++count) {
+      T* item = Cell(head + count);
+      *out = std::move(*item);
+      ++out;
+      item->~T();
+    }
+  } catch (...) {
+    // release the cells already emptied; the failed one stays at the front
+    head_.store(head + count, std::memory_order_release);
+    throw;
+  }
+  head_.store(head + count, std::memory_order_release);
+  return count;
+}
+
+// Free cells as seen by the producer; the consumer's index is reloaded only
+// when the cached one shows a full queue.
+template <typename T, size_t Capacity>
+typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::FreeCells(
+    size_type tail) {
+  if (tail - cached_head_ == Capacity) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+  }
+  return Capacity - (tail - cached_head_);
+}
+
+// Published cells as seen by the consumer; the producer's index is reloaded
+// only when the cached one shows an empty queue.
+template <typename T, size_t Capacity>
+typename spsc_queue<T, Capacity>::size_type
+spsc_queue<T, Capacity>::ReadyCells(size_type head) {
+  if (cached_tail_ == head) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+  }
+  return cached_tail_ - head;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef S21_BTREE_SET_H
+#define S21_BTREE_SET_H
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../BTree/s21_btree.h"
+
+namespace s21 {
+// Same interface as s21::set, backed by s21_BTree. NodeBytes sets the node
+// size and with it the fan-out. Any insert or erase invalidates iterators,
+// including those returned by earlier inserts.
+template <class T, class Compare = std::less<T>,
+          class Allocator = std::allocator<T>, size_t NodeBytes = 256>
+class btree_set : public s21_BTree<T, T, Compare, Allocator, NodeBytes> {
+  using tree_type = s21_BTree<T, T, Compare, Allocator, NodeBytes>;
+
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+
+  btree_set() : tree_type(){};
+  explicit btree_set(const Allocator &alloc) : tree_type(alloc){};
+  explicit btree_set(const Compare &comp, const Allocator &alloc = Allocator())
+      : tree_type(comp, alloc){};
+  btree_set(std::initializer_list<value_type> const &items);
+  btree_set(const btree_set &other) : tree_type(other){};
+  btree_set(btree_set &&other) noexcept : tree_type(std::move(other)){};
+  btree_set &operator=(btree_set &&other)
+      noexcept(std::is_nothrow_move_assignable_v<tree_type>);
+  btree_set &operator=(const btree_set &other);
+  ~btree_set() = default;
+
+  using tree_type::erase;
+  std::pair<iterator, bool> insert(const value_type &value);
+  void erase(const T &value);
+  void merge(btree_set &other);
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+};
+
+template <class T, class Compare, class Allocator, size_t NodeBytes>
+btree_set<T, Compare, Allocator, NodeBytes>::btree_set(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) insert(item);
+}
+
+template <class T, class Compare, class Allocator, size_t NodeBytes>
+btree_set<T, Compare, Allocator, NodeBytes> &
+btree_set<T, Compare, Allocator, NodeBytes>::operator=(
+    btree_set &&other) noexcept(std::is_nothrow_move_assignable_v<tree_type>) {
+  tree_type::operator=(std::move(other));
+  return *this;
+}
+
+template <class T, class Compare, class Allocator, size_t NodeBytes>
+btree_set<T, Compare, Allocator, NodeBytes> &
+btree_set<T, Compare, Allocator, NodeBytes>::operator=(
+    const btree_set &other) {
+  tree_type::operator=(other);
+  return *this;
+}
+
+template <class T, class Compare, class Allocator, size_t NodeBytes>
+std::pair<typename btree_set<T, Compare, Allocator, NodeBytes>::iterator, bool>
+btree_set<T, Compare, Allocator, NodeBytes>::insert(const value_type &value) {
+  return tree_type::InsertUnique(value, value);
+}
+
+template <class T, class Compare, class Allocator, size_t NodeBytes>
+void btree_set<T, Compare, Allocator, NodeBytes>::erase(const T &value) {
+  erase(tree_type::Find(value));
+}
+
+// Same approach as btree_map::merge: what this set already holds is
+// collected into a new tree that replaces other.
+template <class T, class Compare, class Allocator, size_t NodeBytes>
+void btree_set<T, Compare, Allocator, NodeBytes>::merge(btree_set &other) {
+  if (this == &other) return;
+  btree_set rest(other.key_comp(), other.get_allocator());
+  for (const auto &item : other) {
+    if (!insert(item).second) rest.insert(item);
+  }
+  other = std::move(rest);
+}
+
+template <class T, class Compare, class Allocator, size_t NodeBytes>
+template <typename... Args>
+std::vector<
+    std::pair<typename btree_set<T, Compare, Allocator, NodeBytes>::iterator,
+              bool>>
+btree_set<T, Compare, Allocator, NodeBytes>::insert_many(Args &&...args) {
+  std::vector<std::pair<iterator, bool>> results;
+  (results.push_back(insert(std::forward<Args>(args))), ...);
+  return results;
+}
+
+}  // namespace s21
+
+#endif
@@ -1,182 +1,99 @@
 #ifndef S21_SET_H
 #define S21_SET_H
 
+#include <functional>
+#include <type_traits>
 #include <vector>
 
-#include "../s21_container.h"
+#include "../AVLTree/s21_avl.h"
 
 namespace s21 {
-template <class T>
-class set {
+// Elements are kept in an s21_AVLTree ordered by Compare. With a transparent
+// Compare, find and contains also accept keys of other types that Compare
+// can order against T.
+template <class T, class Compare = std::less<T>,
+          class Allocator = std::allocator<T>>
+class set : public s21_AVLTree<T, T, Compare, Allocator> {
+  using tree_type = s21_AVLTree<T, T, Compare, Allocator>;
+
  public:
-  using const_iterator = typename list<T>::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using const_reference = const T &;
-  using iterator = typename list<T>::iterator;
+  using iterator = typename tree_type::iterator;
   using key_type = T;
   using reference = T &;
   using size_type = size_t;
   using value_type = T;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
 
-  set();
+  set() : tree_type(){};
+  explicit set(const Allocator &alloc) : tree_type(alloc){};
+  explicit set(const Compare &comp, const Allocator &alloc = Allocator())
+      : tree_type(comp, alloc){};
   set(std::initializer_list<value_type> const &items);
-  set(const set &s);
-  set(set &&s);
-  ~set();
-
-  set &operator=(set &s);
-  set &operator=(set &&s);
+  set(const set &s) : tree_type(s){};
+  set(set &&s) noexcept : tree_type(std::move(s)){};
+  ~set() = default;
 
-  iterator begin();
-  iterator end();
+  set &operator=(const set &s);
+  set &operator=(set &&s)
+      noexcept(std::is_nothrow_move_assignable_v<tree_type>);
 
-  bool empty();
-  size_type size();
-  size_type max_size();
-
-  void clear();
-  std::pair<iterator, bool> insert(const value_type &value);
-  void erase(iterator pos);
+  using tree_type::erase;
   void erase(const T &value);
-  void swap(set &other);
-  void merge(set &other);
 
   iterator find(const key_type &key);
-  bool contains(const key_type &key);
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K &key) {
+    return this->IteratorAt(tree_type::FindNode(tree_type::root_, key));
+  };
 
   template <typename... Args>
   std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
-
- private:
-  list<T> data;
 };
 
-template <class T>
-set<T>::set() : data() {}
-
-template <class T>
-set<T>::set(std::initializer_list<value_type> const &items) : data(items) {
-  data.sort();
-}
-
-template <class T>
-set<T>::set(const set &s) : data(s.data) {
-  data.sort();
-}
-
-template <class T>
-set<T>::set(set &&s) : data(std::move(s.data)) {
-  data.sort();
+template <class T, class Compare, class Allocator>
+set<T, Compare, Allocator>::set(std::initializer_list<value_type> const &items)
+    : tree_type() {
+  for (const auto &item : items) this->insert(item);
 }
 
-template <class T>
-set<T>::~set() {}
-
-template <class T>
-set<T> &set<T>::operator=(set<T> &&s) {
-  if (this != &s) {
-    data.swap(s);
-  }
+template <class T, class Compare, class Allocator>
+set<T, Compare, Allocator> &set<T, Compare, Allocator>::operator=(
+    set &&s) noexcept(std::is_nothrow_move_assignable_v<tree_type>) {
+  tree_type::operator=(std::move(s));
   return *this;
 }
 
-template <class T>
-set<T> &set<T>::operator=(set<T> &s) {
-  data.clear();
-  for (const auto &item : s) {
-    data.push_back(item);
-  }
+template <class T, class Compare, class Allocator>
+set<T, Compare, Allocator> &set<T, Compare, Allocator>::operator=(
+    const set &s) {
+  tree_type::operator=(s);
   return *this;
 }
 
-template <class T>
-typename set<T>::iterator set<T>::begin() {
-  return data.begin();
-}
-
-template <class T>
-typename set<T>::iterator set<T>::end() {
-  return data.end();
-}
-
-template <class T>
-bool set<T>::empty() {
-  return data.empty();
-}
-
-template <class T>
-typename set<T>::size_type set<T>::size() {
-  return data.size();
-}
-
-template <class T>
-typename set<T>::size_type set<T>::max_size() {
-  return data.max_size();
-}
-
-template <class T>
-void set<T>::clear() {
-  data.clear();
-}
-
-template <class T>
-std::pair<typename set<T>::iterator, bool> set<T>::insert(
-    const value_type &value) {
-  auto it = find(value);
-  if (it != end()) {
-    return std::make_pair(it, false);
-  }
-  data.push_back(value);
-  data.sort();
-  return std::make_pair(--end(), true);
-}
-
-template <class T>
-void set<T>::erase(iterator pos) {
-  data.erase(pos);
-}
-
-template <class T>
-void set<T>::erase(const T &value) {
-  auto it = find(value);
-  if (it != data.end()) {
-    data.erase(it);
-  }
-}
-
-template <class T>
-void set<T>::swap(set &other) {
-  data.swap(other.data);
-}
-
-template <class T>
-void set<T>::merge(set &other) {
-  data.merge(other.data);
-}
-
-template <class T>
-typename set<T>::iterator set<T>::find(const key_type &key) {
-  for (auto it = begin(); it != end(); ++it) {
-    if (*it == key) {
-      return it;
-    }
-  }
-  return end();
+template <class T, class Compare, class Allocator>
+void set<T, Compare, Allocator>::erase(const T &value) {
+  auto *node = tree_type::FindNode(tree_type::root_, value);
+  if (node != nullptr) tree_type::EraseNode(node);
 }
 
-template <class T>
-bool set<T>::contains(const key_type &key) {
-  return find(key) != data.end();
+template <class T, class Compare, class Allocator>
+typename set<T, Compare, Allocator>::iterator set<T, Compare, Allocator>::find(
+    const key_type &key) {
+  return this->IteratorAt(tree_type::FindNode(tree_type::root_, key));
 }
 
-template <class T>
+template <class T, class Compare, class Allocator>
 template <typename... Args>
-std::vector<std::pair<typename set<T>::iterator, bool>> set<T>::insert_many(
-    Args &&...args) {
-  std::vector<std::pair<typename set<T>::iterator, bool>> results;
-  (results.push_back(insert(std::forward<Args>(args))), ...);
+std::vector<std::pair<typename set<T, Compare, Allocator>::iterator, bool>>
+set<T, Compare, Allocator>::insert_many(Args &&...args) {
+  std::vector<std::pair<iterator, bool>> results;
+  (results.push_back(this->insert(std::forward<Args>(args))), ...);
   return results;
 }
 
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
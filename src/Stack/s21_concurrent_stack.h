@@ -0,0 +1,323 @@
+#ifndef S21_CONCURRENT_STACK_H
+#define S21_CONCURRENT_STACK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Lock-free LIFO (Treiber stack). Nodes are never returned to the system
+// while the stack lives: they come from chunks that only grow and are
+// recycled through a second lock-free free list, so a thread that read a
+// node a moment before it was popped still reads valid memory. The top of
+// each list is a 32-bit node index packed with a 32-bit tag that changes on
+// every update, so a CAS fails if the node was popped and pushed back in
+// between (the ABA problem).
+//
+// When the CAS on the top fails, push and pop try to meet in an elimination
+// array instead: a pusher offers its node in a random slot for a short while
+// and a popper that finds it takes it directly, so matching operations
+// complete without touching the contended top.
+//
+// There is no top(): the element could be popped and destroyed while it is
+// being read. Elements are moved out on pop, so T must be nothrow movable.
+template <class T>
+class concurrent_stack {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T>,
+                "concurrent_stack requires a nothrow movable T");
+
+  concurrent_stack();
+  concurrent_stack(const concurrent_stack&) = delete;
+  concurrent_stack& operator=(const concurrent_stack&) = delete;
+  ~concurrent_stack();
+
+  // Approximate while other threads are pushing or popping.
+  bool empty() const;
+  size_type size() const;
+
+  void push(const_reference value) { emplace(value); };
+  void push(value_type&& value) { emplace(std::move(value)); };
+  template <typename... Args>
+  void emplace(Args&&... args);
+  // Discards the top element, if any.
+  void pop();
+  bool try_pop(reference value);
+
+ private:
+  static constexpr uint32_t kNull = 0xFFFFFFFF;
+  static constexpr size_type kFirstChunk = 64;
+  static constexpr size_type kMaxChunks = 25;
+  static constexpr size_type kEliminationSlots = 8;
+  static constexpr int kEliminationSpins = 128;
+  static constexpr size_type kCacheLine = 64;
+
+  struct Node {
+    std::atomic<uint32_t> next;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* Value() { return std::launder(reinterpret_cast<T*>(storage)); };
+  };
+
+  struct alignas(kCacheLine) EliminationSlot {
+    std::atomic<uint64_t> offer;
+  };
+
+  alignas(kCacheLine) std::atomic<uint64_t> head_;
+  alignas(kCacheLine) std::atomic<uint64_t> free_;
+  alignas(kCacheLine) std::atomic<std::ptrdiff_t> size_;
+  alignas(kCacheLine) std::atomic<uint32_t> allocated_;
+  std::atomic<Node*> chunks_[kMaxChunks];
+  EliminationSlot elimination_[kEliminationSlots];
+
+  static uint64_t Pack(uint32_t index, uint32_t tag) {
+    return static_cast<uint64_t>(tag) << 32 | index;
+  };
+  static uint32_t Index(uint64_t tagged) {
+    return static_cast<uint32_t>(tagged);
+  };
+  static uint32_t Tag(uint64_t tagged) {
+    return static_cast<uint32_t>(tagged >> 32);
+  };
+
+  static size_type ChunkOf(uint32_t index);
+  Node* NodeAt(uint32_t index);
+  uint32_t AcquireNode();
+  bool TryPushOnto(std::atomic<uint64_t>& top, uint32_t index);
+  bool TryPopFrom(std::atomic<uint64_t>& top, uint32_t& index);
+  void PushNode(uint32_t index);
+  uint32_t PopNode();
+  bool TryEliminatePush(uint32_t index);
+  uint32_t TryEliminatePop();
+  static size_type PickSlot();
+};
+
+template <typename T>
+concurrent_stack<T>::concurrent_stack()
+    : head_(Pack(kNull, 0)),
+      free_(Pack(kNull, 0)),
+      size_(0),
+      allocated_(0) {
+  for (auto& chunk : chunks_) {
+    chunk.store(nullptr, std::memory_order_relaxed);
+  }
+  for (auto& slot : elimination_) {
+    slot.offer.store(Pack(kNull, 0), std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+concurrent_stack<T>::~concurrent_stack() {
+  uint32_t index = Index(head_.load(std::memory_order_relaxed));
+  while (index != kNull) {
+    Node* node = NodeAt(index);
+    node->Value()->~T();
+    index = node->next.load(std::memory_order_relaxed);
+  }
+  for (auto& chunk : chunks_) {
+    delete[] chunk.load(std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+bool concurrent_stack<T>::empty() const {
+  return Index(head_.load(std::memory_order_acquire)) == kNull;
+}
+
+template <typename T>
+typename concurrent_stack<T>::size_type concurrent_stack<T>::size() const {
+  // a pop may be counted before the push it took
+  std::ptrdiff_t size = size_.load(std::memory_order_relaxed);
+  return size < 0 ? 0 : static_cast<size_type>(size);
+}
+
+template <typename T>
+template <typename... Args>
+void concurrent_stack<T>::emplace(Args&&... args) {
+  uint32_t index = AcquireNode();
+  try {
+    new (NodeAt(index)->storage) T(std::forward<Args>(args)...);
+  } catch (...) {
+    while (!TryPushOnto(free_, index)) {
+    }
+    throw;
+  }
+  PushNode(index);
+}
+
+template <typename T>
+void concurrent_stack<T>::pop() {
+  uint32_t index = PopNode();
+  if (index == kNull) return;
+  NodeAt(index)->Value()->~T();
+  while (!TryPushOnto(free_, index)) {
+  }
+}
+
+template <typename T>
+bool concurrent_stack<T>::try_pop(reference value) {
+  uint32_t index = PopNode();
+  if (index == kNull) return false;
+  T* item = NodeAt(index)->Value();
+  value = std::move(*item);
+  item->~T();
+  while (!TryPushOnto(free_, index)) {
+  }
+  return true;
+}
+
+// Chunk k holds kFirstChunk << k nodes, so the chunk of an index is found
+// from the position of its highest bit.
+template <typename T>
+typename concurrent_stack<T>::size_type concurrent_stack<T>::ChunkOf(
+    uint32_t index) {
+  size_type scaled = index / kFirstChunk + 1;
+  size_type chunk = 0;
+  while ((scaled >> (chunk + 1)) != 0) ++chunk;
+  return chunk;
+}
+
+template <typename T>
+typename concurrent_stack<T>::Node* concurrent_stack<T>::NodeAt(
+    uint32_t index) {
+  size_type chunk = ChunkOf(index);
+  size_type offset = index - kFirstChunk * ((size_type{1} << chunk) - 1);
+  return chunks_[chunk].load(std::memory_order_acquire) + offset;
+}
+
+// Reuses a free node, or hands out the next fresh index and makes sure the
+// chunk holding it exists.
+template <typename T>
+uint32_t concurrent_stack<T>::AcquireNode() {
+  uint32_t index;
+  while (!TryPopFrom(free_, index)) {
+  }
+  if (index != kNull) return index;
+
+  size_type limit = kFirstChunk * ((size_type{1} << kMaxChunks) - 1);
+  index = allocated_.fetch_add(1, std::memory_order_relaxed);
+  if (index >= limit) {
+    allocated_.fetch_sub(1, std::memory_order_relaxed);
+    throw std::length_error("Can't allocate memory of this size");
+  }
+  size_type chunk = ChunkOf(index);
+  if (chunks_[chunk].load(std::memory_order_acquire) == nullptr) {
+    Node* fresh = new Node[kFirstChunk << chunk];
+    Node* expected = nullptr;
+    if (!chunks_[chunk].compare_exchange_strong(expected, fresh,
+                                                std::memory_order_acq_rel)) {
+      delete[] fresh;
+    }
+  }
+  return index;
+}
+
+template <typename T>
+bool concurrent_stack<T>::TryPushOnto(std::atomic<uint64_t>& top,
+                                      uint32_t index) {
+  uint64_t old_top = top.load(std::memory_order_relaxed);
+  NodeAt(index)->next.store(Index(old_top), std::memory_order_relaxed);
+  return top.compare_exchange_weak(old_top, Pack(index, Tag(old_top) + 1),
+                                   std::memory_order_release,
+                                   std::memory_order_relaxed);
+}
+
+// Returns false if the CAS lost a race; index is kNull for an empty list.
+// The next link may be stale if the node was popped meanwhile, but then the
+// tag has moved on and the CAS fails.
+template <typename T>
+bool concurrent_stack<T>::TryPopFrom(std::atomic<uint64_t>& top,
+                                     uint32_t& index) {
+  uint64_t old_top = top.load(std::memory_order_acquire);
+  index = Index(old_top);
+  if (index == kNull) return true;
+  uint32_t next = NodeAt(index)->next.load(std::memory_order_relaxed);
+  return top.compare_exchange_weak(old_top, Pack(next, Tag(old_top) + 1),
+                                   std::memory_order_acquire,
+                                   std::memory_order_relaxed);
+}
+
+template <typename T>
+void concurrent_stack<T>::PushNode(uint32_t index) {
+  for (;;) {
+    if (TryPushOnto(head_, index)) {
+      size_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    if (TryEliminatePush(index)) return;
+  }
+}
+
+template <typename T>
+uint32_t concurrent_stack<T>::PopNode() {
+  for (;;) {
+    uint32_t index;
+    if (TryPopFrom(head_, index)) {
+      if (index != kNull) size_.fetch_sub(1, std::memory_order_relaxed);
+      return index;
+    }
+    index = TryEliminatePop();
+    if (index != kNull) return index;
+  }
+}
+
+// Offers the node in a random slot and waits briefly for a popper to take
+// it. Each slot carries a tag as well, so a withdrawal cannot mistake a later
+// offer of the same recycled node for its own.
+template <typename T>
+bool concurrent_stack<T>::TryEliminatePush(uint32_t index) {
+  std::atomic<uint64_t>& slot = elimination_[PickSlot()].offer;
+  uint64_t current = slot.load(std::memory_order_relaxed);
+  if (Index(current) != kNull) return false;
+  uint64_t offer = Pack(index, Tag(current) + 1);
+  if (!slot.compare_exchange_strong(current, offer,
+                                    std::memory_order_release,
+                                    std::memory_order_relaxed)) {
+    return false;
+  }
+  for (int i = 0; i < kEliminationSpins; ++i) {
+    if (slot.load(std::memory_order_relaxed) != offer) return true;
+  }
+  // withdraw; failing means a popper took the node after all
+  return !slot.compare_exchange_strong(offer, Pack(kNull, Tag(offer) + 1),
+                                       std::memory_order_relaxed);
+}
+
+template <typename T>
+uint32_t concurrent_stack<T>::TryEliminatePop() {
+  std::atomic<uint64_t>& slot = elimination_[PickSlot()].offer;
+  uint64_t current = slot.load(std::memory_order_acquire);
+  if (Index(current) == kNull) return kNull;
+  if (slot.compare_exchange_strong(current, Pack(kNull, Tag(current) + 1),
+                                   std::memory_order_acquire,
+                                   std::memory_order_relaxed)) {
+    return Index(current);
+  }
+  return kNull;
+}
+
+template <typename T>
+typename concurrent_stack<T>::size_type concurrent_stack<T>::PickSlot() {
+  thread_local uint32_t state = static_cast<uint32_t>(
+      std::hash<std::thread::id>()(std::this_thread::get_id()) | 1);
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state % kEliminationSlots;
+}
+
+}  // namespace s21
+
+#endif
@@ -3,17 +3,26 @@
 
 #include <initializer_list>
 #include <iostream>
+#include <utility>
+
+#include "../Vector/s21_vector.h"
 
 namespace s21 {
-template <class T>
+// LIFO adapter in the manner of std::stack. Container must provide back,
+// push_back, emplace_back, pop_back, size, empty and swap; vector (the
+// default) keeps the elements in one contiguous buffer, list works too.
+template <class T, class Container = s21::vector<T>>
 class Stack {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
 
   Stack();
+  explicit Stack(const Container& container);
+  explicit Stack(Container&& container);
   Stack(std::initializer_list<value_type> const& items);
   Stack(const Stack& s);
   Stack(Stack&& s);
@@ -22,138 +31,114 @@ class Stack {
 
   bool empty();
   size_type size();
+  // Only available when Container has the corresponding method.
+  void reserve(size_type n);
+  void reserve_nodes(size_type n);
 
   void push(const_reference value);
+  void push(value_type&& value);
+  template <typename... Args>
+  void emplace(Args&&... args);
   void pop();
   void swap(Stack& other);
 
-  Stack<T>& operator=(Stack&& s);
+  Stack& operator=(Stack&& s);
   ~Stack();
 
  private:
-  struct Node {
-    T value;
-    Node* next = nullptr;
-    Node* prev = nullptr;
-  };
+  Container container_;
+};
 
-  Node* head;
-  Node* tail;
-  size_t stack_size;
+template <typename T, typename Container>
+s21::Stack<T, Container>::Stack() : container_() {}
 
-  void Free();
-};
+template <typename T, typename Container>
+s21::Stack<T, Container>::Stack(const Container& container)
+    : container_(container) {}
 
-template <typename T>
-s21::Stack<T>::Stack() : head(nullptr), tail(nullptr), stack_size(0) {}
+template <typename T, typename Container>
+s21::Stack<T, Container>::Stack(Container&& container)
+    : container_(std::move(container)) {}
 
-template <typename T>
-s21::Stack<T>::Stack(std::initializer_list<value_type> const& items)
-    : stack_size(0) {
-  for (auto it = items.begin(); it != items.end(); it++) {
-    push(*it);
-  }
-}
+template <typename T, typename Container>
+s21::Stack<T, Container>::Stack(std::initializer_list<value_type> const& items)
+    : container_(items) {}
 
-template <typename T>
-s21::Stack<T>::Stack(const Stack& s) : stack_size(0) {
-  size_t i = 0;
-  for (Node* node = s.tail; i < s.stack_size; i++, node = node->prev) {
-    push(node->value);
-  }
+template <typename T, typename Container>
+s21::Stack<T, Container>::Stack(const Stack& s) : container_(s.container_) {}
+
+template <typename T, typename Container>
+s21::Stack<T, Container>::Stack(Stack&& s)
+    : container_(std::move(s.container_)) {}
+
+template <typename T, typename Container>
+typename s21::Stack<T, Container>::const_reference
+s21::Stack<T, Container>::top() {
+  return container_.back();
 }
 
-template <typename T>
-s21::Stack<T>::Stack(Stack&& s) : stack_size(0) {
-  std::swap(stack_size, s.stack_size);
-  std::swap(head, s.head);
-  std::swap(tail, s.tail);
+template <typename T, typename Container>
+bool s21::Stack<T, Container>::empty() {
+  return container_.empty();
 }
 
-template <typename T>
-typename s21::Stack<T>::const_reference s21::Stack<T>::top() {
-  return head->value;
+template <typename T, typename Container>
+typename s21::Stack<T, Container>::size_type s21::Stack<T, Container>::size() {
+  return container_.size();
 }
 
-template <typename T>
-bool s21::Stack<T>::empty() {
-  return size() == 0;
+template <typename T, typename Container>
+void s21::Stack<T, Container>::reserve(size_type n) {
+  container_.reserve(n);
 }
 
-template <typename T>
-typename s21::Stack<T>::size_type s21::Stack<T>::size() {
-  return stack_size;
+template <typename T, typename Container>
+void s21::Stack<T, Container>::reserve_nodes(size_type n) {
+  container_.reserve_nodes(n);
 }
 
-template <typename T>
-void s21::Stack<T>::push(s21::Stack<T>::const_reference value) {
-  Node* new_node = new Node;
-  new_node->value = value;
+template <typename T, typename Container>
+void s21::Stack<T, Container>::push(const_reference value) {
+  container_.push_back(value);
+}
 
-  if (empty()) {
-    tail = new_node;
-    head = new_node;
-  } else {
-    new_node->next = head;
-    head->prev = new_node;
-    head = new_node;
-  }
+template <typename T, typename Container>
+void s21::Stack<T, Container>::push(value_type&& value) {
+  container_.push_back(std::move(value));
+}
 
-  stack_size++;
+template <typename T, typename Container>
+template <typename... Args>
+void s21::Stack<T, Container>::emplace(Args&&... args) {
+  container_.emplace_back(std::forward<Args>(args)...);
 }
 
-template <typename T>
-void s21::Stack<T>::pop() {
+template <typename T, typename Container>
+void s21::Stack<T, Container>::pop() {
   if (empty()) {
     return;
   }
-
-  if (size() == 1) {
-    delete head;
-    head = nullptr;
-    tail = nullptr;
-  } else {
-    Node* temp_head = head;
-    head = head->next;
-    head->prev = nullptr;
-    delete temp_head;
-  }
-
-  stack_size--;
+  container_.pop_back();
 }
 
-template <typename T>
-void s21::Stack<T>::swap(Stack& other) {
-  Stack temp(*this);
-  *this = std::move(other);
-  other.Free();
-  size_t i = 0;
-  for (Node* node = temp.tail; i < temp.stack_size; i++, node = node->prev) {
-    other.push(node->value);
-  }
+// Exchanges the underlying buffers; no element is copied or moved.
+template <typename T, typename Container>
+void s21::Stack<T, Container>::swap(Stack& other) {
+  container_.swap(other.container_);
 }
 
-template <typename T>
-s21::Stack<T>& s21::Stack<T>::operator=(Stack&& s) {
-  std::swap(stack_size, s.stack_size);
-  std::swap(head, s.head);
-  std::swap(tail, s.tail);
-
-  return *this;
-}
-
-template <typename T>
-void s21::Stack<T>::Free() {
-  while (!empty()) {
-    pop();
+// The old contents are released right away and s is left empty.
+template <typename T, typename Container>
+s21::Stack<T, Container>& s21::Stack<T, Container>::operator=(Stack&& s) {
+  if (this != &s) {
+    container_ = std::move(s.container_);
   }
+  return *this;
 }
 
-template <typename T>
-s21::Stack<T>::~Stack() {
-  Free();
-}
+template <typename T, typename Container>
+s21::Stack<T, Container>::~Stack() {}
 
 };  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
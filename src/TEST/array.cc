@@ -320,4 +320,49 @@ TEST(array_fill, case1) {
   EXPECT_EQ(s21_arr_string[1], "21");
   EXPECT_EQ(s21_arr_string[2], "21");
   EXPECT_EQ(s21_arr_string[3], "21");
-}
\ No newline at end of file
+}
+TEST(array_swap, case2) {
+  s21::array<int, 1000> s21_arr_ref_int;
+  s21::array<int, 1000> s21_arr_res_int;
+  for (int i = 0; i < 1000; ++i) {
+    s21_arr_ref_int[i] = i;
+    s21_arr_res_int[i] = -i;
+  }
+
+  s21_arr_ref_int.swap(s21_arr_res_int);
+
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(s21_arr_ref_int[i], -i);
+    EXPECT_EQ(s21_arr_res_int[i], i);
+  }
+}
+
+TEST(array_fill, case2) {
+  s21::array<char, 7> s21_arr_char;
+  s21::array<long long, 300> s21_arr_long;
+
+  s21_arr_char.fill('z');
+  s21_arr_long.fill(-3);
+
+  for (char c : s21_arr_char) {
+    EXPECT_EQ(c, 'z');
+  }
+  for (long long value : s21_arr_long) {
+    EXPECT_EQ(value, -3);
+  }
+}
+
+TEST(array_constructor, case7) {
+  s21::array<double, 300> s21_arr_ref_double;
+  s21_arr_ref_double.fill(0.5);
+  s21_arr_ref_double[299] = 1.5;
+
+  s21::array<double, 300> s21_arr_res_double(s21_arr_ref_double);
+  s21::array<double, 300> s21_arr_moved_double;
+  s21_arr_moved_double = std::move(s21_arr_ref_double);
+
+  EXPECT_EQ(s21_arr_res_double[0], 0.5);
+  EXPECT_EQ(s21_arr_res_double[299], 1.5);
+  EXPECT_EQ(s21_arr_moved_double[0], 0.5);
+  EXPECT_EQ(s21_arr_moved_double[299], 1.5);
+}
@@ -0,0 +1,258 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../s21_containerplus.h"
+
+namespace {
+// Small nodes (five pairs of ints, three strings) make the trees deep enough
+// to split, borrow and merge on every level with a few thousand keys.
+template <class Key, class T>
+using small_map = s21::btree_map<Key, T, std::less<Key>,
+                                 std::allocator<std::pair<const Key, T>>, 64>;
+
+template <class Map, class Expected>
+void ExpectSame(Map &m, const Expected &expected) {
+  ASSERT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (const auto &item : expected) {
+    ASSERT_EQ(it->first, item.first);
+    ASSERT_EQ(it->second, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == m.end());
+  // walk back as well to check the parent links
+  for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit) {
+    --it;
+    ASSERT_EQ(it->first, rit->first);
+  }
+  EXPECT_TRUE(it == m.begin());
+}
+
+struct allocation_stats {
+  int live = 0;
+};
+
+template <class T>
+struct counting_allocator {
+  using value_type = T;
+
+  explicit counting_allocator(allocation_stats *s) : stats(s) {}
+  template <class U>
+  counting_allocator(const counting_allocator<U> &other)
+      : stats(other.stats) {}
+
+  T *allocate(size_t n) {
+    stats->live += n;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *ptr, size_t n) {
+    stats->live -= n;
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  template <class U>
+  bool operator==(const counting_allocator<U> &other) const {
+    return stats == other.stats;
+  }
+  template <class U>
+  bool operator!=(const counting_allocator<U> &other) const {
+    return stats != other.stats;
+  }
+
+  allocation_stats *stats;
+};
+}  // namespace
+
+TEST(btree_map, Constructors) {
+  s21::btree_map<int, char> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.begin() == empty.end());
+
+  s21::btree_map<int, char> items = {{3, 'c'}, {1, 'a'}, {2, 'b'}, {1, 'x'}};
+  ExpectSame(items, std::map<int, char>{{1, 'a'}, {2, 'b'}, {3, 'c'}});
+
+  s21::btree_map<int, char> copy(items);
+  s21::btree_map<int, char> moved(std::move(items));
+  EXPECT_TRUE(items.empty());
+  ExpectSame(moved, std::map<int, char>{{1, 'a'}, {2, 'b'}, {3, 'c'}});
+
+  items = copy;
+  copy.clear();
+  EXPECT_EQ(items.size(), 3U);
+  copy = std::move(items);
+  EXPECT_EQ(copy.at(3), 'c');
+}
+
+TEST(btree_map, AtAndSubscript) {
+  s21::btree_map<char, std::string> s21_map = {{'a', "Alina"}, {'b', "Boris"}};
+  EXPECT_THROW(s21_map.at('g'), std::out_of_range);
+  s21_map['a'] = "Vasya";
+  s21_map['c'] += "Chuck";
+  EXPECT_EQ(s21_map.at('a'), "Vasya");
+  EXPECT_EQ(s21_map['c'], "Chuck");
+  EXPECT_EQ(s21_map.size(), 3U);
+
+  EXPECT_FALSE(s21_map.insert_or_assign('b', "Borka").second);
+  EXPECT_EQ(s21_map.at('b'), "Borka");
+  auto results = s21_map.insert_many(std::make_pair('d', std::string("Dan")),
+                                     std::make_pair('a', std::string("Ann")));
+  EXPECT_TRUE(results[0].second);
+  EXPECT_FALSE(results[1].second);
+  EXPECT_EQ(s21_map.at('a'), "Vasya");
+}
+
+TEST(btree_map, InsertEraseMatchesStd) {
+  small_map<int, int> s21_map;
+  std::map<int, int> orig_map;
+  unsigned state = 12345;
+  for (int i = 0; i < 20000; ++i) {
+    state = state * 1103515245 + 12345;
+    int key = static_cast<int>(state >> 16) % 2000;
+    if (i % 3 == 2) {
+      auto it = s21_map.find(key);
+      EXPECT_EQ(it != s21_map.end(), orig_map.erase(key) == 1);
+      s21_map.erase(it);
+    } else {
+      auto pr = s21_map.insert(key, i);
+      EXPECT_EQ(pr.second, orig_map.insert({key, i}).second);
+      EXPECT_EQ(pr.first->first, key);
+    }
+    if (i % 1000 == 0) ExpectSame(s21_map, orig_map);
+  }
+  ExpectSame(s21_map, orig_map);
+  while (!s21_map.empty()) s21_map.erase(s21_map.begin());
+  EXPECT_TRUE(s21_map.begin() == s21_map.end());
+}
+
+TEST(btree_map, SequentialInsertErase) {
+  small_map<int, int> s21_map;
+  for (int i = 0; i < 100000; ++i) {
+    EXPECT_TRUE(s21_map.insert(i, -i).second);
+  }
+  for (int i = 0; i < 100000; i += 2) s21_map.erase(s21_map.begin());
+  EXPECT_EQ(s21_map.size(), 50000U);
+  EXPECT_FALSE(s21_map.contains(49999));
+  EXPECT_EQ(s21_map.at(50000), -50000);
+  EXPECT_EQ(s21_map.at(99999), -99999);
+  EXPECT_EQ((--s21_map.end())->first, 99999);
+  // erasing from the back merges away the leaf end() points into
+  while (s21_map.size() > 1000) s21_map.erase(--s21_map.end());
+  EXPECT_EQ((--s21_map.end())->first, 50999);
+  EXPECT_EQ(s21_map.begin()->first, 50000);
+}
+
+TEST(btree_map, OwningValues) {
+  small_map<std::string, std::unique_ptr<int>> s21_map;
+  for (int i = 0; i < 500; ++i) {
+    s21_map[std::to_string(i)] = std::make_unique<int>(i);
+  }
+  for (int i = 0; i < 500; i += 3) {
+    s21_map.erase(s21_map.find(std::to_string(i)));
+  }
+  EXPECT_EQ(s21_map.size(), 333U);
+  EXPECT_EQ(*s21_map.at("499"), 499);
+  EXPECT_FALSE(s21_map.contains("498"));
+
+  small_map<std::string, std::unique_ptr<int>> moved(std::move(s21_map));
+  EXPECT_EQ(*moved.begin()->second, 1);
+}
+
+TEST(btree_map, MergeAndSwap) {
+  s21::btree_map<int, int> s21_map = {{1, 1}, {2, 2}, {3, 3}};
+  s21::btree_map<int, int> other = {{3, 0}, {4, 4}, {5, 5}};
+  s21_map.merge(other);
+  EXPECT_EQ(s21_map.size(), 5U);
+  EXPECT_EQ(s21_map.at(3), 3);
+  ExpectSame(other, std::map<int, int>{{3, 0}});
+
+  s21_map.swap(other);
+  EXPECT_EQ(s21_map.size(), 1U);
+  EXPECT_EQ(other.size(), 5U);
+}
+
+TEST(btree_map, CompareAndTransparentLookup) {
+  s21::btree_map<int, char, std::greater<int>> s21_map = {{1, 'a'}, {3, 'c'}};
+  s21_map.insert(2, 'b');
+  EXPECT_EQ(s21_map.begin()->first, 3);
+  EXPECT_FALSE(s21_map.key_comp()(1, 2));
+
+  s21::btree_map<std::string, int, std::less<>> names = {{"one", 1},
+                                                         {"two", 2}};
+  std::string_view key = "two";
+  EXPECT_TRUE(names.contains(key));
+  EXPECT_EQ(names.find(key)->second, 2);
+  EXPECT_TRUE(names.find(std::string_view("three")) == names.end());
+}
+
+TEST(btree_map, ConstLookup) {
+  small_map<int, int> s21_map;
+  for (int i = 0; i < 100; ++i) s21_map[i] = -i;
+  const small_map<int, int> &view = s21_map;
+  small_map<int, int>::const_iterator it = view.find(42);
+  EXPECT_EQ(it->second, -42);
+  EXPECT_TRUE(view.contains(99));
+  EXPECT_FALSE(view.contains(100));
+  EXPECT_TRUE(view.find(100) == view.end());
+
+  const s21::btree_map<std::string, int, std::less<>> names = {{"one", 1}};
+  EXPECT_TRUE(names.contains(std::string_view("one")));
+  EXPECT_EQ(names.find(std::string_view("one"))->second, 1);
+}
+
+TEST(btree_map, CountingAllocator) {
+  allocation_stats stats;
+  {
+    using alloc_type = counting_allocator<std::pair<const int, int>>;
+    using map_type = s21::btree_map<int, int, std::less<int>, alloc_type, 64>;
+    map_type s21_map{alloc_type(&stats)};
+    for (int i = 0; i < 1000; ++i) s21_map[i] = i;
+    EXPECT_GT(stats.live, 0);
+    int live = stats.live;
+
+    map_type s21_copy(s21_map);
+    EXPECT_EQ(stats.live, 2 * live);
+    EXPECT_EQ(s21_copy.get_allocator().stats, &stats);
+    while (!s21_copy.empty()) s21_copy.erase(s21_copy.begin());
+    EXPECT_EQ(stats.live, live);
+  }
+  EXPECT_EQ(stats.live, 0);
+}
+
+// The allocator does not propagate on assignment, so each map keeps its own
+// and the values are rebuilt in the target's nodes.
+TEST(btree_map, AssignKeepsAllocator) {
+  allocation_stats left_stats;
+  allocation_stats right_stats;
+  {
+    using alloc_type = counting_allocator<std::pair<const int, int>>;
+    using map_type = s21::btree_map<int, int, std::less<int>, alloc_type, 64>;
+    map_type left{alloc_type(&left_stats)};
+    map_type right{alloc_type(&right_stats)};
+    for (int i = 0; i < 500; ++i) right[i] = i;
+
+    left = right;
+    EXPECT_EQ(left.get_allocator().stats, &left_stats);
+    EXPECT_EQ(left_stats.live, right_stats.live);
+
+    right[500] = 500;
+    left = std::move(right);
+    EXPECT_EQ(left.get_allocator().stats, &left_stats);
+    EXPECT_GT(left_stats.live, 0);
+    EXPECT_EQ(right_stats.live, 0);
+    EXPECT_TRUE(right.empty());
+    ASSERT_EQ(left.size(), 501U);
+    int expected = 0;
+    for (const auto &item : left) EXPECT_EQ(item.second, expected++);
+    EXPECT_EQ(expected, 501);
+    while (left.size() > 10) left.erase(left.begin());
+    EXPECT_EQ(left.begin()->first, 491);
+  }
+  EXPECT_EQ(left_stats.live, 0);
+  EXPECT_EQ(right_stats.live, 0);
+}
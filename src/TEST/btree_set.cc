@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+
+#include "../s21_containerplus.h"
+
+namespace {
+// Nodes of ten ints, so a few thousand keys give a tree several levels deep.
+using small_set = s21::btree_set<int, std::less<int>, std::allocator<int>, 64>;
+
+template <class Set>
+void ExpectSame(Set &s, const std::set<int> &expected) {
+  ASSERT_EQ(s.size(), expected.size());
+  auto it = s.begin();
+  for (int item : expected) {
+    ASSERT_EQ(*it, item);
+    ++it;
+  }
+  EXPECT_TRUE(it == s.end());
+  for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit) {
+    ASSERT_EQ(*--it, *rit);
+  }
+  EXPECT_TRUE(it == s.begin());
+}
+}  // namespace
+
+TEST(btree_set, Basics) {
+  s21::btree_set<int> s21_set{5, 4, 6, 4};
+  EXPECT_EQ(s21_set.size(), 3U);
+  EXPECT_EQ(*s21_set.begin(), 4);
+  EXPECT_FALSE(s21_set.insert(5).second);
+  EXPECT_TRUE(s21_set.contains(6));
+  EXPECT_TRUE(s21_set.find(7) == s21_set.end());
+
+  s21_set.erase(5);
+  s21_set.erase(7);
+  ExpectSame(s21_set, {4, 6});
+
+  auto results = s21_set.insert_many(1, 4, 9);
+  EXPECT_TRUE(results[0].second);
+  EXPECT_FALSE(results[1].second);
+  ExpectSame(s21_set, {1, 4, 6, 9});
+}
+
+TEST(btree_set, InsertEraseMatchesStd) {
+  small_set s21_set;
+  std::set<int> orig_set;
+  unsigned state = 54321;
+  for (int i = 0; i < 30000; ++i) {
+    state = state * 1103515245 + 12345;
+    int key = static_cast<int>(state >> 16) % 3000;
+    if (i % 2 == 1) {
+      s21_set.erase(key);
+      orig_set.erase(key);
+    } else {
+      EXPECT_EQ(s21_set.insert(key).second, orig_set.insert(key).second);
+    }
+    if (i % 1000 == 0) ExpectSame(s21_set, orig_set);
+  }
+  ExpectSame(s21_set, orig_set);
+
+  small_set copy(s21_set);
+  for (int key : orig_set) copy.erase(key);
+  EXPECT_TRUE(copy.empty());
+  ExpectSame(s21_set, orig_set);
+}
+
+TEST(btree_set, MinimalFanOut) {
+  // a node this small holds only three values
+  s21::btree_set<std::string, std::less<std::string>,
+                 std::allocator<std::string>, 1>
+      s21_set;
+  std::set<std::string> orig_set;
+  for (int i = 0; i < 300; ++i) {
+    s21_set.insert(std::to_string(i * 7 % 300));
+    orig_set.insert(std::to_string(i * 7 % 300));
+  }
+  for (int i = 0; i < 300; i += 2) s21_set.erase(std::to_string(i));
+  for (int i = 0; i < 300; i += 2) orig_set.erase(std::to_string(i));
+  ASSERT_EQ(s21_set.size(), orig_set.size());
+  auto it = s21_set.begin();
+  for (const auto &item : orig_set) EXPECT_EQ(*it++, item);
+}
+
+TEST(btree_set, Merge) {
+  s21::btree_set<int> s21_set{1, 2, 3};
+  s21::btree_set<int> other{3, 4, 5};
+  s21_set.merge(other);
+  ExpectSame(s21_set, {1, 2, 3, 4, 5});
+  ExpectSame(other, {3});
+}
+
+TEST(btree_set, Compare) {
+  s21::btree_set<int, std::greater<int>> s21_set{1, 3, 2};
+  EXPECT_EQ(*s21_set.begin(), 3);
+
+  s21::btree_set<std::string, std::less<>> names{"one", "two"};
+  EXPECT_TRUE(names.contains(std::string_view("two")));
+  EXPECT_TRUE(names.find(std::string_view("three")) == names.end());
+}
@@ -0,0 +1,368 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Queue/s21_concurrent_queue.h"
+
+namespace {
+constexpr int kProducers = 4;
+constexpr int kConsumers = 4;
+constexpr int kPerProducer = 20000;
+
+// Every producer pushes its own range of values; the consumers check that
+// each one comes out exactly once and in order per producer.
+template <class Queue>
+void RunStress(Queue& queue) {
+  std::vector<std::atomic<int>> seen(kProducers * kPerProducer);
+  for (auto& flag : seen) flag = 0;
+  std::atomic<int> consumed{0};
+  std::atomic<bool> ordered{true};
+  std::vector<std::thread> threads;
+
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&queue, p] {
+      for (int i = 0; i < kPerProducer; ++i) {
+        queue.push(p * kPerProducer + i);
+      }
+    });
+  }
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&] {
+      std::vector<int> last(kProducers, -1);
+      int value;
+      while (consumed.load() < kProducers * kPerProducer) {
+        if (!queue.try_pop(value)) {
+          std::this_thread::yield();
+          continue;
+        }
+        int producer = value / kPerProducer;
+        if (value <= last[producer]) ordered = false;
+        last[producer] = value;
+        seen[value].fetch_add(1);
+        consumed.fetch_add(1);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_TRUE(ordered.load());
+  for (auto& flag : seen) ASSERT_EQ(flag.load(), 1);
+  EXPECT_TRUE(queue.empty());
+}
+
+// Copying throws once copies_left runs out; moving never does.
+struct fragile {
+  explicit fragile(int v) : value(v) {}
+  fragile(const fragile& other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+  }
+  fragile(fragile&&) noexcept = default;
+  fragile& operator=(const fragile&) = default;
+  fragile& operator=(fragile&&) noexcept = default;
+
+  int value;
+  static int copies_left;
+};
+
+int fragile::copies_left = 0;
+
+// Accepts elements through push_back until its room runs out, then throws.
+struct cramped_sink {
+  using value_type = int;
+
+  void push_back(int value) {
+    if (items.size() == room) throw std::length_error("sink is full");
+    items.push_back(value);
+  }
+
+  size_t room;
+  std::vector<int> items;
+};
+
+// Refuses every seventh element it is given.
+struct flaky_sink {
+  using value_type = int;
+
+  void push_back(int value) {
+    if (++calls % 7 == 0) throw std::runtime_error("sink hiccup");
+    items.push_back(value);
+  }
+
+  int calls = 0;
+  std::vector<int> items;
+};
+
+// Consumers drain the queue in batches through sinks that keep throwing;
+// every value must still come out exactly once.
+template <class Queue>
+void RunFlakyBulkStress(Queue& queue) {
+  constexpr int kTotal = kProducers * kPerProducer;
+  std::atomic<int> delivered{0};
+  std::vector<flaky_sink> sinks(kConsumers);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&queue, p] {
+      for (int i = 0; i < kPerProducer; ++i) {
+        queue.push(p * kPerProducer + i);
+      }
+    });
+  }
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&queue, &delivered, &sink = sinks[c]] {
+      while (delivered.load() < kTotal) {
+        size_t before = sink.items.size();
+        try {
+          if (queue.pop_bulk(std::back_inserter(sink), 8) == 0) {
+            std::this_thread::yield();
+          }
+        } catch (const std::runtime_error&) {
+        }
+        delivered.fetch_add(static_cast<int>(sink.items.size() - before));
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  std::vector<int> all;
+  for (const auto& sink : sinks) {
+    all.insert(all.end(), sink.items.begin(), sink.items.end());
+  }
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(all.size(), static_cast<size_t>(kTotal));
+  for (int i = 0; i < kTotal; ++i) ASSERT_EQ(all[i], i);
+  EXPECT_TRUE(queue.empty());
+}
+}  // namespace
+
+TEST(concurrent_queue, basic) {
+  s21::concurrent_queue<int> queue(5);
+  EXPECT_EQ(queue.capacity(), 8U);
+  EXPECT_TRUE(queue.empty());
+
+  for (int i = 0; i < 8; ++i) EXPECT_TRUE(queue.try_push(i));
+  EXPECT_FALSE(queue.try_push(8));
+  EXPECT_EQ(queue.size(), 8U);
+
+  int value = -1;
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(concurrent_queue, wrap_around) {
+  s21::concurrent_queue<std::string> queue(4);
+  std::string value;
+  for (int i = 0; i < 50; ++i) {
+    queue.push(std::to_string(i));
+    queue.emplace(3, 'x');
+    ASSERT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, std::to_string(i));
+    ASSERT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, "xxx");
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(concurrent_queue, bulk) {
+  s21::concurrent_queue<int> queue(8);
+  std::vector<int> items{1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(queue.push_bulk(items.begin(), items.end()), 6U);
+  // only two cells are left
+  EXPECT_EQ(queue.push_bulk(items.begin(), items.end()), 2U);
+  EXPECT_EQ(queue.size(), 8U);
+
+  std::vector<int> out;
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(out), 5), 5U);
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(out), 5), 3U);
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(out), 5), 0U);
+  std::vector<int> expected{1, 2, 3, 4, 5, 6, 1, 2};
+  EXPECT_EQ(out, expected);
+}
+
+TEST(concurrent_queue, bulk_throwing_copy) {
+  s21::concurrent_queue<fragile> queue(4);
+  fragile::copies_left = 100;
+  std::vector<fragile> items{fragile(1), fragile(2), fragile(3)};
+  fragile::copies_left = 1;
+  EXPECT_THROW(queue.push_bulk(items.begin(), items.end()),
+               std::runtime_error);
+  EXPECT_TRUE(queue.empty());
+
+  // no cell is left claimed but unpublished
+  fragile::copies_left = 100;
+  EXPECT_EQ(queue.push_bulk(items.begin(), items.end()), 3U);
+  queue.push(fragile(4));
+  EXPECT_EQ(queue.size(), 4U);
+  fragile out(0);
+  for (int i = 1; i <= 4; ++i) {
+    ASSERT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(out.value, i);
+  }
+}
+
+TEST(concurrent_queue, bulk_throwing_output) {
+  s21::concurrent_queue<int> queue(4);
+  for (int i = 0; i < 4; ++i) queue.push(i);
+  cramped_sink sink{1, {}};
+  EXPECT_THROW(queue.pop_bulk(std::back_inserter(sink), 4), std::length_error);
+  EXPECT_EQ(sink.items, std::vector<int>{0});
+  // the undelivered elements are back at the front, in order
+  EXPECT_EQ(queue.size(), 3U);
+  EXPECT_TRUE(queue.try_push(4));
+  EXPECT_FALSE(queue.try_push(5));
+  std::vector<int> out(4);
+  EXPECT_EQ(queue.pop_bulk(out.begin(), 4), 4U);
+  EXPECT_EQ(out, (std::vector<int>{1, 2, 3, 4}));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(concurrent_queue, destroys_leftovers) {
+  auto item = std::make_shared<int>(7);
+  {
+    s21::concurrent_queue<std::shared_ptr<int>> queue(4);
+    queue.insert_many_back(item, item, item);
+    EXPECT_EQ(item.use_count(), 4);
+  }
+  EXPECT_EQ(item.use_count(), 1);
+}
+
+TEST(concurrent_queue, stress) {
+  s21::concurrent_queue<int> queue(64);
+  RunStress(queue);
+}
+
+TEST(concurrent_queue, stress_bulk) {
+  s21::concurrent_queue<int> queue(256);
+  std::atomic<long long> sum{0};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&queue] {
+      std::vector<int> batch(16, 1);
+      int left = kPerProducer;
+      while (left > 0) {
+        auto end = batch.begin() + std::min(left, 16);
+        int pushed = static_cast<int>(queue.push_bulk(batch.begin(), end));
+        if (pushed == 0) std::this_thread::yield();
+        left -= pushed;
+      }
+    });
+  }
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&queue, &sum] {
+      std::vector<int> out(16);
+      while (sum.load() < kProducers * kPerProducer) {
+        size_t count = queue.pop_bulk(out.begin(), out.size());
+        if (count == 0) std::this_thread::yield();
+        sum.fetch_add(static_cast<long long>(count));
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(sum.load(), kProducers * kPerProducer);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(concurrent_queue, stress_bulk_throwing_output) {
+  s21::concurrent_queue<int> queue(64);
+  RunFlakyBulkStress(queue);
+}
+
+TEST(unbounded_concurrent_queue, basic) {
+  s21::unbounded_concurrent_queue<int, 4> queue;
+  EXPECT_TRUE(queue.empty());
+  for (int i = 0; i < 10; ++i) EXPECT_TRUE(queue.try_push(i));
+  EXPECT_EQ(queue.size(), 10U);
+
+  int value = -1;
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(unbounded_concurrent_queue, bulk) {
+  s21::unbounded_concurrent_queue<std::string, 2> queue;
+  std::vector<std::string> items{"a", "b", "c", "d", "e"};
+  EXPECT_EQ(queue.push_bulk(items.begin(), items.end()), 5U);
+
+  std::vector<std::string> out;
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(out), 3), 3U);
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(out), 3), 2U);
+  EXPECT_EQ(out, items);
+}
+
+TEST(unbounded_concurrent_queue, destroys_leftovers) {
+  auto item = std::make_shared<int>(7);
+  {
+    s21::unbounded_concurrent_queue<std::shared_ptr<int>, 2> queue;
+    queue.insert_many_back(item, item, item);
+    std::shared_ptr<int> out;
+    EXPECT_TRUE(queue.try_pop(out));
+    out.reset();
+    EXPECT_EQ(item.use_count(), 3);
+  }
+  EXPECT_EQ(item.use_count(), 1);
+}
+
+TEST(unbounded_concurrent_queue, stress) {
+  s21::unbounded_concurrent_queue<int, 64> queue;
+  RunStress(queue);
+}
+
+TEST(unbounded_concurrent_queue, bulk_throwing_output) {
+  s21::unbounded_concurrent_queue<int, 2> queue;
+  queue.insert_many_back(0, 1, 2, 3);
+  cramped_sink sink{1, {}};
+  EXPECT_THROW(queue.pop_bulk(std::back_inserter(sink), 4), std::length_error);
+  EXPECT_EQ(sink.items, std::vector<int>{0});
+  // the element the sink refused was queued again, at the back
+  std::vector<int> out;
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(out), 4), 3U);
+  EXPECT_EQ(out, (std::vector<int>{2, 3, 1}));
+}
+
+TEST(unbounded_concurrent_queue, stress_bulk_throwing_output) {
+  s21::unbounded_concurrent_queue<int, 64> queue;
+  RunFlakyBulkStress(queue);
+}
+
+// Small segments retire every few operations while all threads stay busy;
+// the ones waiting to be freed must not pile up.
+TEST(unbounded_concurrent_queue, reclaims_under_load) {
+  using queue_type = s21::unbounded_concurrent_queue<int, 4>;
+  queue_type queue;
+  constexpr int kThreads = 4;
+  constexpr int kRounds = 50000;
+  std::atomic<size_t> most_retired{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&queue, &most_retired] {
+      int value;
+      for (int i = 0; i < kRounds; ++i) {
+        queue.push(i);
+        queue.try_pop(value);
+        size_t retired = queue.retired_segments();
+        size_t most = most_retired.load();
+        while (retired > most &&
+               !most_retired.compare_exchange_weak(most, retired)) {
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_LE(most_retired.load(), queue_type::kHazardSlots + kThreads);
+  EXPECT_LE(queue.retired_segments(), queue_type::kHazardSlots);
+  EXPECT_TRUE(queue.empty());
+}
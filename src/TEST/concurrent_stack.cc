@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Stack/s21_concurrent_stack.h"
+
+TEST(concurrent_stack, basic) {
+  s21::concurrent_stack<int> stack;
+  EXPECT_TRUE(stack.empty());
+  EXPECT_EQ(stack.size(), 0U);
+
+  for (int i = 0; i < 200; ++i) stack.push(i);
+  EXPECT_FALSE(stack.empty());
+  EXPECT_EQ(stack.size(), 200U);
+
+  int value = -1;
+  for (int i = 199; i >= 0; --i) {
+    ASSERT_TRUE(stack.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(stack.try_pop(value));
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(concurrent_stack, reuses_nodes) {
+  s21::concurrent_stack<std::string> stack;
+  std::string value;
+  for (int i = 0; i < 1000; ++i) {
+    stack.emplace(3, 'a');
+    stack.push(std::to_string(i));
+    ASSERT_TRUE(stack.try_pop(value));
+    EXPECT_EQ(value, std::to_string(i));
+    stack.pop();
+  }
+  EXPECT_TRUE(stack.empty());
+  stack.pop();
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(concurrent_stack, destroys_leftovers) {
+  auto item = std::make_shared<int>(5);
+  {
+    s21::concurrent_stack<std::shared_ptr<int>> stack;
+    stack.push(item);
+    stack.push(item);
+    stack.pop();
+    EXPECT_EQ(item.use_count(), 2);
+  }
+  EXPECT_EQ(item.use_count(), 1);
+}
+
+// Threads push and pop in bursts so nodes are recycled while other threads
+// still hold stale indices; each value must come out exactly once.
+TEST(concurrent_stack, stress) {
+  constexpr int kThreads = 8;
+  constexpr int kPerThread = 20000;
+  s21::concurrent_stack<int> stack;
+  std::vector<std::atomic<int>> seen(kThreads * kPerThread);
+  for (auto& flag : seen) flag = 0;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&stack, &seen, t] {
+      int value;
+      for (int i = 0; i < kPerThread; ++i) {
+        stack.push(t * kPerThread + i);
+        if (i % 3 != 0 && stack.try_pop(value)) seen[value].fetch_add(1);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  int value;
+  while (stack.try_pop(value)) seen[value].fetch_add(1);
+  for (auto& flag : seen) ASSERT_EQ(flag.load(), 1);
+  EXPECT_TRUE(stack.empty());
+  EXPECT_EQ(stack.size(), 0U);
+}
+
+TEST(concurrent_stack, producers_and_consumers) {
+  constexpr int kThreads = 4;
+  constexpr int kPerThread = 20000;
+  s21::concurrent_stack<long long> stack;
+  std::atomic<long long> sum{0};
+  std::atomic<int> popped{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&stack] {
+      for (int i = 1; i <= kPerThread; ++i) stack.push(i);
+    });
+    threads.emplace_back([&stack, &sum, &popped] {
+      long long value;
+      while (popped.load() < kThreads * kPerThread) {
+        if (stack.try_pop(value)) {
+          sum.fetch_add(value);
+          popped.fetch_add(1);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  long long expected = kThreads * (1LL * kPerThread * (kPerThread + 1) / 2);
+  EXPECT_EQ(sum.load(), expected);
+  EXPECT_TRUE(stack.empty());
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <functional>
+#include <memory>
+#include <string>
 #include <utility>
 
 #include "../s21_container.h"
@@ -428,6 +431,128 @@ TEST(TestList, SpliceEmptyLeft) {
   }
 }
 
+TEST(TestList, SpliceKeepsNodes) {
+  s21::list<std::string> l1({"a", "d"});
+  s21::list<std::string> l2({"b", "c"});
+  const std::string* address = &l2.front();
+
+  l1.splice(++l1.begin(), l2);
+
+  EXPECT_EQ(4, l1.size());
+  EXPECT_TRUE(l2.empty());
+  EXPECT_EQ(address, &*++l1.begin());
+  EXPECT_EQ("d", l1.back());
+}
+
+TEST(TestList, SpliceElement) {
+  s21::list<int> l1({1, 2, 3});
+  s21::list<int> l2({10, 20, 30});
+
+  l1.splice(l1.end(), l2, ++l2.begin());
+  l1.splice(l1.begin(), l1, --l1.end());
+  l1.splice(l1.begin(), l1, l1.begin());
+
+  int expected[] = {20, 1, 2, 3};
+  int i = 0;
+  for (auto iter = l1.begin(); iter != l1.end(); ++iter, ++i) {
+    EXPECT_EQ(expected[i], *iter);
+  }
+  EXPECT_EQ(4, l1.size());
+  EXPECT_EQ(2, l2.size());
+  EXPECT_EQ(10, l2.front());
+  EXPECT_EQ(30, l2.back());
+}
+
+TEST(TestList, SpliceRange) {
+  s21::list<int> l1({1, 5});
+  s21::list<int> l2({2, 3, 4, 6});
+
+  l1.splice(--l1.end(), l2, l2.begin(), --l2.end());
+  l1.splice(l1.end(), l2, l2.begin(), l2.end());
+  l1.splice(l1.begin(), l1, ++l1.begin(), l1.end());
+
+  int expected[] = {2, 3, 4, 5, 6, 1};
+  int i = 0;
+  for (auto iter = l1.begin(); iter != l1.end(); ++iter, ++i) {
+    EXPECT_EQ(expected[i], *iter);
+  }
+  EXPECT_EQ(6, l1.size());
+  EXPECT_EQ(0, l2.size());
+  EXPECT_EQ(1, l1.back());
+}
+
+TEST(TestList, MergeComparator) {
+  s21::list<int> l1({9, 7, 3, 1});
+  s21::list<int> l2({8, 7, 2});
+
+  l1.merge(l2, std::greater<int>());
+
+  int expected[] = {9, 8, 7, 7, 3, 2, 1};
+  int i = 0;
+  for (auto iter = l1.begin(); iter != l1.end(); ++iter, ++i) {
+    EXPECT_EQ(expected[i], *iter);
+  }
+  EXPECT_EQ(7, l1.size());
+  EXPECT_EQ(1, l1.back());
+  EXPECT_TRUE(l2.empty());
+}
+
+TEST(TestList, MergeStable) {
+  s21::list<std::pair<int, char>> l1({{1, 'a'}, {2, 'a'}});
+  s21::list<std::pair<int, char>> l2({{1, 'b'}, {2, 'b'}});
+
+  l1.merge(l2, [](const std::pair<int, char>& a,
+                  const std::pair<int, char>& b) { return a.first < b.first; });
+
+  std::string order;
+  for (const auto& item : l1) order += item.second;
+  EXPECT_EQ("abab", order);
+}
+
+TEST(TestList, SentinelIterators) {
+  s21::list<int> l({1, 2, 3});
+  EXPECT_EQ(sizeof(s21::list<int>::iterator), sizeof(void*));
+
+  auto iter = l.end();
+  EXPECT_EQ(3, *--iter);
+  EXPECT_EQ(3, *iter--);
+  EXPECT_EQ(2, *iter);
+  ++iter;
+  ++iter;
+  EXPECT_TRUE(iter == l.end());
+  ++iter;
+  EXPECT_TRUE(iter == l.begin());
+
+  const s21::list<int>& view = l;
+  auto citer = view.end();
+  --citer;
+  EXPECT_EQ(3, *citer);
+}
+
+TEST(TestList, SwapAndMoveKeepRings) {
+  s21::list<int> l1({1, 2, 3});
+  s21::list<int> l2;
+
+  l1.swap(l2);
+  EXPECT_TRUE(l1.empty());
+  EXPECT_TRUE(l1.begin() == l1.end());
+  EXPECT_EQ(3, *--l2.end());
+
+  s21::list<int> l3(std::move(l2));
+  EXPECT_TRUE(l2.begin() == l2.end());
+  l2.push_back(7);
+  EXPECT_EQ(7, l2.front());
+  EXPECT_EQ(1, *--(--(--l3.end())));
+
+  l3.reverse();
+  int expected[] = {3, 2, 1};
+  int i = 0;
+  for (auto iter = l3.begin(); iter != l3.end(); ++iter, ++i) {
+    EXPECT_EQ(expected[i], *iter);
+  }
+  EXPECT_EQ(1, *--l3.end());
+}
+
 TEST(TestList, ReverseEmpty) {
   s21::list<char> l;
 
@@ -476,6 +601,30 @@ TEST(TestList, Unique) {
   }
 }
 
+TEST(TestList, UniquePredicate) {
+  s21::list<int> l({1, 2, 4, 5, 6, 9, 10, 12});
+
+  l.unique([](int a, int b) { return b - a <= 2; });
+
+  int expected[] = {1, 4, 9, 12};
+  int i = 0;
+  for (auto iter = l.begin(); iter != l.end(); ++iter, ++i) {
+    EXPECT_EQ(expected[i], *iter);
+  }
+  EXPECT_EQ(4, l.size());
+  EXPECT_EQ(12, l.back());
+}
+
+TEST(TestList, UniqueTail) {
+  s21::list<int> l({1, 1, 1});
+
+  l.unique();
+
+  EXPECT_EQ(1, l.size());
+  EXPECT_EQ(1, l.back());
+  EXPECT_EQ(1, *--l.end());
+}
+
 TEST(TestList, SortAlreadySorted) {
   s21::list<int> l({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
 
@@ -532,6 +681,55 @@ TEST(TestList, SortZeroValues) {
   }
 }
 
+TEST(TestList, SortComparator) {
+  s21::list<int> l({5, 6, 4, 10, 8, 2, 3, 7, 9, 1});
+
+  l.sort(std::greater<int>());
+
+  int i = 10;
+  for (auto iter = l.begin(); iter != l.end(); ++iter, --i) {
+    EXPECT_EQ(i, *iter);
+  }
+  EXPECT_EQ(10, l.front());
+  EXPECT_EQ(1, l.back());
+  EXPECT_EQ(1, *--l.end());
+}
+
+TEST(TestList, SortStable) {
+  s21::list<std::pair<int, int>> l;
+  for (int i = 0; i < 1000; ++i) {
+    l.push_back({(i * 7919) % 10, i});
+  }
+
+  l.sort([](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+    return a.first < b.first;
+  });
+
+  EXPECT_EQ(1000, l.size());
+  auto prev = l.begin();
+  for (auto iter = ++l.begin(); iter != l.end(); ++iter, ++prev) {
+    ASSERT_LE((*prev).first, (*iter).first);
+    if ((*prev).first == (*iter).first) {
+      ASSERT_LT((*prev).second, (*iter).second);
+    }
+  }
+}
+
+TEST(TestList, SortRelinksNodes) {
+  s21::list<std::string> l({"d", "b", "a", "c"});
+  const std::string* address = &*l.begin();
+
+  l.sort();
+
+  std::string expected[] = {"a", "b", "c", "d"};
+  int i = 3;
+  for (auto iter = --l.end(); i >= 0; --iter, --i) {
+    EXPECT_EQ(expected[i], *iter);
+    if (i == 0) break;
+  }
+  EXPECT_EQ(address, &l.back());
+}
+
 TEST(TestList, InsertManyOnce) {
   s21::list<int> l({1, 2, 3});
 
@@ -683,3 +881,110 @@ TEST(TestList, InsertManyFrontNothing) {
     EXPECT_EQ(text[i], *iter);
   }
 }
+
+TEST(TestList, Emplace) {
+  s21::list<std::pair<int, std::string>> l;
+  l.emplace_back(2, "two");
+  l.emplace_front(0, "zero");
+  auto pos = l.begin();
+  ++pos;
+  auto inserted = l.emplace(pos, 1, "one");
+
+  EXPECT_EQ(3, l.size());
+  EXPECT_EQ("one", (*inserted).second);
+
+  std::string text[] = {"zero", "one", "two"};
+  size_t i = 0;
+  for (auto iter = l.begin(); iter != l.end(); ++iter, ++i) {
+    EXPECT_EQ(static_cast<int>(i), (*iter).first);
+    EXPECT_EQ(text[i], (*iter).second);
+  }
+}
+
+TEST(TestList, EmplaceFrontEmpty) {
+  s21::list<std::string> l;
+  l.emplace_front(3, 'a');
+  l.emplace_back("b");
+
+  EXPECT_EQ(2, l.size());
+  EXPECT_EQ("aaa", l.front());
+  EXPECT_EQ("b", l.back());
+}
+
+struct list_allocation_stats {
+  int live = 0;
+};
+
+template <class T>
+struct list_counting_allocator {
+  using value_type = T;
+
+  explicit list_counting_allocator(list_allocation_stats* s) : stats(s) {}
+  template <class U>
+  list_counting_allocator(const list_counting_allocator<U>& other)
+      : stats(other.stats) {}
+
+  T* allocate(size_t n) {
+    stats->live += n;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* ptr, size_t n) {
+    stats->live -= n;
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  template <class U>
+  bool operator==(const list_counting_allocator<U>& other) const {
+    return stats == other.stats;
+  }
+  template <class U>
+  bool operator!=(const list_counting_allocator<U>& other) const {
+    return stats != other.stats;
+  }
+
+  list_allocation_stats* stats;
+};
+
+TEST(TestList, CountingAllocator) {
+  list_allocation_stats stats;
+  {
+    s21::list<std::string, list_counting_allocator<std::string>> l{
+        list_counting_allocator<std::string>(&stats)};
+    l.push_back("b");
+    l.push_front("a");
+    l.emplace_back(2, 'c');
+    l.insert_many(l.begin(), "x", "y");
+    EXPECT_EQ(stats.live, 5);
+
+    l.erase(l.begin());
+    l.pop_back();
+    EXPECT_EQ(stats.live, 3);
+    EXPECT_EQ(l.front(), "y");
+    EXPECT_EQ(l.get_allocator().stats, &stats);
+
+    auto copy(l);
+    EXPECT_EQ(stats.live, 6);
+    l.clear();
+    EXPECT_EQ(stats.live, 3);
+  }
+  EXPECT_EQ(stats.live, 0);
+}
+
+TEST(TestList, CountingAllocatorAdapters) {
+  list_allocation_stats stats;
+  {
+    list_counting_allocator<int> alloc(&stats);
+    s21::queue<int, s21::list<int, list_counting_allocator<int>>> queue{
+        s21::list<int, list_counting_allocator<int>>(alloc)};
+    s21::set<int, std::less<int>, list_counting_allocator<int>> set{
+        alloc};
+    queue.insert_many_back(1, 2, 3);
+    set.insert(2);
+    set.insert(1);
+    set.insert(2);
+    EXPECT_EQ(stats.live, 5);
+    queue.pop();
+    EXPECT_EQ(stats.live, 4);
+  }
+  EXPECT_EQ(stats.live, 0);
+}
@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include "../s21_container.h"
 
@@ -182,3 +188,262 @@ TEST(map, SwapMap) {
   EXPECT_EQ(x, 3);
   EXPECT_EQ(y, 1);
 }
+
+struct map_allocation_stats {
+  int live = 0;
+};
+
+template <class T>
+struct map_counting_allocator {
+  using value_type = T;
+
+  explicit map_counting_allocator(map_allocation_stats* s) : stats(s) {}
+  template <class U>
+  map_counting_allocator(const map_counting_allocator<U>& other)
+      : stats(other.stats) {}
+
+  T* allocate(size_t n) {
+    stats->live += n;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* ptr, size_t n) {
+    stats->live -= n;
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  template <class U>
+  bool operator==(const map_counting_allocator<U>& other) const {
+    return stats == other.stats;
+  }
+  template <class U>
+  bool operator!=(const map_counting_allocator<U>& other) const {
+    return stats != other.stats;
+  }
+
+  map_allocation_stats* stats;
+};
+
+TEST(map, CountingAllocator) {
+  map_allocation_stats stats;
+  {
+    using alloc_type = map_counting_allocator<std::pair<const int, char>>;
+    using map_type = s21::map<int, char, std::less<int>, alloc_type>;
+    map_type s21_map{alloc_type(&stats)};
+    s21_map.insert(2, 'b');
+    s21_map.insert(1, 'a');
+    s21_map.insert(3, 'c');
+    s21_map[4] = 'd';
+    EXPECT_EQ(stats.live, 4);
+
+    s21_map.erase(s21_map.begin());
+    EXPECT_EQ(stats.live, 3);
+    EXPECT_EQ(s21_map.at(4), 'd');
+
+    map_type s21_copy(s21_map);
+    EXPECT_EQ(stats.live, 6);
+    EXPECT_EQ(s21_copy.get_allocator().stats, &stats);
+  }
+  EXPECT_EQ(stats.live, 0);
+}
+
+// The allocator does not propagate on assignment, so each map keeps its own
+// and the values are rebuilt in the target's nodes.
+TEST(map, AssignKeepsAllocator) {
+  map_allocation_stats left_stats;
+  map_allocation_stats right_stats;
+  {
+    using alloc_type = map_counting_allocator<std::pair<const int, char>>;
+    using map_type = s21::map<int, char, std::less<int>, alloc_type>;
+    map_type left{alloc_type(&left_stats)};
+    map_type right{alloc_type(&right_stats)};
+    for (int i = 0; i < 5; ++i) right.insert(i, 'a' + i);
+
+    left = right;
+    EXPECT_EQ(left.get_allocator().stats, &left_stats);
+    EXPECT_EQ(left_stats.live, 5);
+    EXPECT_EQ(right_stats.live, 5);
+
+    right.insert(5, 'f');
+    left = std::move(right);
+    EXPECT_EQ(left.get_allocator().stats, &left_stats);
+    EXPECT_EQ(left_stats.live, 6);
+    EXPECT_EQ(right_stats.live, 0);
+    EXPECT_TRUE(right.empty());
+    ASSERT_EQ(left.size(), 6U);
+    for (int i = 0; i < 6; ++i) EXPECT_EQ(left.at(i), 'a' + i);
+    for (int i = 6; i < 40; ++i) left.insert(i, 'x');
+    EXPECT_EQ(left.size(), 40U);
+
+    map_type other{alloc_type(&left_stats)};
+    other = std::move(left);
+    EXPECT_EQ(left_stats.live, 40);
+    EXPECT_EQ(other.at(39), 'x');
+  }
+  EXPECT_EQ(left_stats.live, 0);
+  EXPECT_EQ(right_stats.live, 0);
+}
+
+TEST(map, InsertEraseMatchesStd) {
+  s21::map<int, int> s21_map;
+  std::map<int, int> orig_map;
+  unsigned state = 12345;
+  for (int i = 0; i < 20000; ++i) {
+    state = state * 1103515245 + 12345;
+    int key = static_cast<int>(state >> 16) % 2000;
+    auto pr = s21_map.insert(key, i);
+    EXPECT_EQ(pr.second, orig_map.insert({key, i}).second);
+    if (i % 3 == 2) {
+      // the returned iterator must point at key itself
+      s21_map.erase(pr.first);
+      orig_map.erase(key);
+      EXPECT_FALSE(s21_map.contains(key));
+    } else {
+      EXPECT_EQ(s21_map.at(key), orig_map.at(key));
+    }
+  }
+  ASSERT_EQ(s21_map.size(), orig_map.size());
+  for (const auto& item : orig_map) {
+    EXPECT_EQ(s21_map.at(item.first), item.second);
+  }
+}
+
+TEST(map, SequentialInsertErase) {
+  s21::map<int, int> s21_map;
+  for (int i = 0; i < 100000; ++i) {
+    EXPECT_TRUE(s21_map.insert(i, -i).second);
+  }
+  for (int i = 0; i < 100000; i += 2) s21_map.erase(s21_map.begin());
+  EXPECT_EQ(s21_map.size(), 50000U);
+  EXPECT_FALSE(s21_map.contains(49999));
+  EXPECT_EQ(s21_map.at(50000), -50000);
+  EXPECT_EQ(s21_map.at(99999), -99999);
+}
+
+TEST(map, SizeFollowsModifiers) {
+  s21::map<int, int> s21_map = {{1, 1}, {2, 2}, {3, 3}};
+  s21::map<int, int> other = {{3, 0}, {4, 4}, {5, 5}, {6, 6}};
+  EXPECT_EQ(s21_map.size(), 3U);
+  EXPECT_FALSE(s21_map.insert(2, 0).second);
+  EXPECT_EQ(s21_map.size(), 3U);
+
+  s21_map.merge(other);
+  EXPECT_EQ(s21_map.size(), 6U);
+  EXPECT_EQ(other.size(), 1U);
+
+  s21::map<int, int> copy;
+  copy = s21_map;
+  EXPECT_EQ(copy.size(), 6U);
+  copy.erase(copy.begin());
+  EXPECT_EQ(copy.size(), 5U);
+  EXPECT_EQ(s21_map.size(), 6U);
+
+  copy.swap(other);
+  EXPECT_EQ(copy.size(), 1U);
+  EXPECT_EQ(other.size(), 5U);
+
+  s21::map<int, int> moved(std::move(other));
+  EXPECT_EQ(moved.size(), 5U);
+  EXPECT_EQ(other.size(), 0U);
+  moved.clear();
+  EXPECT_EQ(moved.size(), 0U);
+  EXPECT_TRUE(moved.empty());
+}
+
+TEST(map, CustomCompare) {
+  s21::map<int, char, std::greater<int>> s21_map = {{1, 'a'}, {3, 'c'}};
+  s21_map.insert(2, 'b');
+  EXPECT_EQ(s21_map.at(2), 'b');
+  EXPECT_TRUE(s21_map.find(4) == s21_map.end());
+  EXPECT_FALSE(s21_map.key_comp()(1, 2));
+
+  auto it = s21_map.begin();
+  for (int key = 3; key > 0; --key, ++it) {
+    EXPECT_TRUE(s21_map.find(key) == it);
+  }
+}
+
+// Ordered by id only, so a bare id can be looked up without building a key.
+struct map_account {
+  int id;
+  std::string owner;
+};
+
+struct map_account_less {
+  using is_transparent = void;
+  bool operator()(const map_account &a, const map_account &b) const {
+    return a.id < b.id;
+  }
+  bool operator()(const map_account &a, int id) const { return a.id < id; }
+  bool operator()(int id, const map_account &a) const { return id < a.id; }
+};
+
+TEST(map, TransparentLookup) {
+  s21::map<std::string, int, std::less<>> s21_map = {{"one", 1}, {"two", 2}};
+  std::string_view key = "two";
+  EXPECT_TRUE(s21_map.contains(key));
+  EXPECT_TRUE(s21_map.find(key) != s21_map.end());
+  EXPECT_TRUE(s21_map.find(std::string_view("three")) == s21_map.end());
+
+  s21::map<map_account, int, map_account_less> accounts;
+  accounts.insert({2, "bob"}, 20);
+  accounts.insert({1, "ann"}, 10);
+  EXPECT_TRUE(accounts.contains(2));
+  EXPECT_FALSE(accounts.contains(3));
+  EXPECT_TRUE(accounts.find(1) == accounts.begin());
+}
+
+TEST(map, IteratorReferencesNode) {
+  s21::map<int, std::string> s21_map = {{1, "one"}, {2, "two"}};
+  auto it = s21_map.begin();
+  const std::pair<const int, std::string> *first = &*it;
+  (*it).second += "!";
+  it->second += "?";
+  EXPECT_EQ(s21_map.at(1), "one!?");
+  EXPECT_EQ(&*s21_map.begin(), first);
+  EXPECT_EQ((++it)->first, 2);
+
+  s21_map.insert_or_assign(1, "uno");
+  EXPECT_EQ(&*s21_map.begin(), first);
+  EXPECT_EQ(first->second, "uno");
+}
+
+TEST(map, SubscriptBuildsInPlace) {
+  s21::map<int, std::unique_ptr<int>> s21_map;
+  s21_map[2] = std::make_unique<int>(20);
+  s21_map[1] = std::make_unique<int>(10);
+  EXPECT_EQ(*s21_map[2], 20);
+  EXPECT_EQ(*s21_map.at(1), 10);
+  EXPECT_EQ(*s21_map.begin()->second, 10);
+  EXPECT_EQ(s21_map.size(), 2U);
+}
+
+TEST(map, IteratorsSurviveRebalancing) {
+  s21::map<int, int> s21_map;
+  std::vector<std::pair<int, const std::pair<const int, int> *>> kept;
+  for (int i = 0; i < 64; ++i) {
+    auto pr = s21_map.insert(i * 2, i);
+    kept.push_back({i * 2, &*pr.first});
+  }
+  // the inserts and erases below rotate the tree around the kept nodes
+  for (int i = 0; i < 64; ++i) s21_map.insert(i * 2 + 1, -i);
+  for (int i = 0; i < 64; i += 2) s21_map.erase(s21_map.find(i * 2 + 1));
+  for (const auto& item : kept) {
+    EXPECT_EQ(&*s21_map.find(item.first), item.second);
+    EXPECT_EQ(item.second->second, item.first / 2);
+  }
+}
+
+TEST(map, MergeMovesNodes) {
+  s21::map<int, int> s21_map = {{1, 1}, {2, 2}, {3, 3}};
+  s21::map<int, int> other = {{3, 0}, {4, 4}, {5, 5}, {6, 6}};
+  const std::pair<const int, int> *five = &*other.find(5);
+  s21_map.merge(other);
+  int expected = 1;
+  for (auto it = s21_map.begin(); it != s21_map.end(); ++it, ++expected) {
+    EXPECT_EQ((*it).first, expected);
+  }
+  EXPECT_EQ(expected, 7);
+  EXPECT_EQ(&*s21_map.find(5), five);
+  EXPECT_EQ(other.at(3), 0);
+  EXPECT_EQ(other.size(), 1U);
+}
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <set>
+#include <string>
+#include <string_view>
 
 #include "../s21_containerplus.h"
 
@@ -384,3 +387,82 @@ TEST(INSERT_MANY, case3) {
   EXPECT_TRUE(Mymultiset.contains('e'));
   EXPECT_TRUE(Mymultiset.contains('f'));
 }
+
+TEST(COMPARE, case1) {
+  s21::multiset<int, std::greater<int>> Mymultiset{1, 3, 2, 3};
+  Mymultiset.insert(2);
+  std::multiset<int, std::greater<int>> multiset{1, 3, 2, 3, 2};
+  auto it = multiset.begin();
+  for (auto item : Mymultiset) EXPECT_EQ(item, *it++);
+  EXPECT_EQ(*Mymultiset.lower_bound(2), 2);
+  EXPECT_EQ(*Mymultiset.upper_bound(2), 1);
+  EXPECT_EQ(Mymultiset.count(3), 2U);
+}
+
+TEST(COMPARE, case2) {
+  s21::multiset<std::string, std::less<>> Mymultiset{"b", "a", "b", "c"};
+  std::string_view key = "b";
+  EXPECT_EQ(Mymultiset.count(key), 2U);
+  EXPECT_TRUE(Mymultiset.contains(key));
+  auto range = Mymultiset.equal_range(key);
+  EXPECT_EQ(*range.first, "b");
+  EXPECT_EQ(*range.second, "c");
+  EXPECT_EQ(*Mymultiset.lower_bound(key), "b");
+  EXPECT_EQ(*Mymultiset.upper_bound(key), "c");
+  EXPECT_TRUE(Mymultiset.find(std::string_view("d")) == Mymultiset.end());
+}
+
+TEST(TREE, case1) {
+  s21::multiset<int> Mymultiset;
+  std::multiset<int> multiset;
+  unsigned state = 4242;
+  for (int i = 0; i < 60000; ++i) {
+    state = state * 1103515245 + 12345;
+    int key = static_cast<int>(state >> 16) % 500;
+    if (i % 4 == 3) {
+      Mymultiset.erase(key);
+      auto it = multiset.find(key);
+      if (it != multiset.end()) multiset.erase(it);
+    } else {
+      Mymultiset.insert(key);
+      multiset.insert(key);
+    }
+  }
+  EXPECT_EQ(Mymultiset.size(), multiset.size());
+  auto it = multiset.begin();
+  for (auto item : Mymultiset) EXPECT_EQ(item, *it++);
+  for (int key = -1; key <= 500; key += 7) {
+    EXPECT_EQ(Mymultiset.count(key), multiset.count(key));
+    auto lower = Mymultiset.lower_bound(key);
+    auto orig_lower = multiset.lower_bound(key);
+    ASSERT_EQ(lower == Mymultiset.end(), orig_lower == multiset.end());
+    if (orig_lower != multiset.end()) {
+      EXPECT_EQ(*lower, *orig_lower);
+    }
+  }
+}
+
+// Equal elements stay in insertion order, also across merge.
+TEST(MERGE, case4) {
+  using item = std::pair<int, char>;
+  auto first_less = [](const item &a, const item &b) {
+    return a.first < b.first;
+  };
+  s21::multiset<item, decltype(first_less)> Mymultiset1(first_less);
+  s21::multiset<item, decltype(first_less)> Mymultiset2(first_less);
+  Mymultiset1.insert({1, 'a'});
+  Mymultiset1.insert({2, 'b'});
+  Mymultiset2.insert({1, 'c'});
+  Mymultiset2.insert({1, 'd'});
+  Mymultiset1.insert({1, 'e'});
+  Mymultiset1.merge(Mymultiset2);
+  EXPECT_TRUE(Mymultiset2.empty());
+  EXPECT_EQ(Mymultiset1.count({1, 'x'}), 4U);
+
+  std::string order;
+  for (const auto &element : Mymultiset1) order += element.second;
+  EXPECT_EQ(order, "aecdb");
+  EXPECT_EQ((*Mymultiset1.find({1, 'x'})).second, 'a');
+  Mymultiset1.erase({1, 'x'});
+  EXPECT_EQ((*Mymultiset1.begin()).second, 'e');
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../s21_container.h"
+
+TEST(pool_allocator_list, case1) {
+  s21::list<int, s21::pool_allocator<int>> l;
+  l.push_back(1);
+  const int* first = &l.back();
+  l.pop_back();
+  l.push_back(2);
+
+  // the node released by pop_back is the first one handed out again
+  EXPECT_EQ(&l.back(), first);
+  EXPECT_EQ(l.front(), 2);
+}
+
+TEST(pool_allocator_list, case2) {
+  s21::list<long, s21::pool_allocator<long>> l;
+  l.reserve_nodes(100);
+  l.push_back(0);
+  l.push_back(1);
+  const char* prev = reinterpret_cast<const char*>(&l.back());
+  std::ptrdiff_t stride = prev - reinterpret_cast<const char*>(&l.front());
+  for (long i = 2; i < 100; ++i) {
+    l.push_back(i);
+    const char* cur = reinterpret_cast<const char*>(&l.back());
+    EXPECT_EQ(cur - prev, stride);
+    prev = cur;
+  }
+  EXPECT_EQ(l.size(), 100U);
+}
+
+TEST(pool_allocator_list, case3) {
+  s21::list<std::string, s21::pool_allocator<std::string>> l1{"a", "b"};
+  s21::list<std::string, s21::pool_allocator<std::string>> l2(l1);
+  EXPECT_TRUE(l1.get_allocator() != l2.get_allocator());
+
+  l2.push_back("c");
+  l1 = std::move(l2);
+  EXPECT_EQ(l1.size(), 3U);
+  EXPECT_EQ(l1.back(), "c");
+
+  l1.swap(l2);
+  EXPECT_TRUE(l1.empty());
+  EXPECT_EQ(l2.front(), "a");
+}
+
+TEST(pool_allocator_stack, case1) {
+  s21::Stack<int, s21::list<int, s21::pool_allocator<int>>> s;
+  s.reserve_nodes(10);
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 1000; ++i) {
+      s.push(i);
+    }
+    while (!s.empty()) {
+      s.pop();
+    }
+  }
+  s.push(7);
+  EXPECT_EQ(s.top(), 7);
+  EXPECT_EQ(s.size(), 1U);
+}
+
+TEST(pool_allocator_queue, case1) {
+  s21::queue<std::string,
+             s21::list<std::string, s21::pool_allocator<std::string>>>
+      q;
+  q.reserve_nodes(4);
+  q.insert_many_back("one", "two", "three");
+  q.pop();
+  q.push("four");
+  EXPECT_EQ(q.front(), "two");
+  EXPECT_EQ(q.back(), "four");
+  EXPECT_EQ(q.size(), 3U);
+}
+
+TEST(pool_allocator_vector, case1) {
+  // multi-element requests bypass the pool and go to std::allocator
+  s21::vector<int, s21::pool_allocator<int>> v;
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(i);
+  }
+  EXPECT_EQ(v[99], 99);
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 #include "../s21_container.h"
@@ -163,4 +165,76 @@ TEST(TestQueue, InsertManyBackEmpty) {
   for (int i = 1; i < 4; ++i, queue.pop()) {
     EXPECT_EQ(i, queue.front());
   }
-}
\ No newline at end of file
+}
+TEST(TestQueue, Emplace) {
+  s21::queue<std::pair<int, std::string>> queue;
+  queue.emplace(1, "one");
+  queue.emplace(2, "two");
+
+  EXPECT_EQ(queue.size(), 2);
+  EXPECT_EQ(queue.front().second, "one");
+  EXPECT_EQ(queue.back().second, "two");
+}
+
+TEST(TestQueue, RingBufferWrapAround) {
+  s21::queue<int> queue;
+  queue.reserve(8);
+  int next_in = 0;
+  int next_out = 0;
+  for (int round = 0; round < 100; ++round) {
+    for (int i = 0; i < 5; ++i) {
+      queue.push(next_in++);
+    }
+    for (int i = 0; i < 5; ++i) {
+      EXPECT_EQ(queue.front(), next_out++);
+      queue.pop();
+    }
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(TestQueue, RingBufferGrowth) {
+  s21::ring_buffer<std::string> buffer;
+  buffer.reserve(5);
+  EXPECT_EQ(buffer.capacity(), 8U);
+
+  for (int i = 0; i < 6; ++i) {
+    buffer.push_back(std::to_string(i));
+  }
+  buffer.pop_front();
+  buffer.pop_front();
+  // the live range now wraps past the end of the buffer before growing
+  for (int i = 6; i < 20; ++i) {
+    buffer.push_back(std::to_string(i));
+  }
+
+  EXPECT_EQ(buffer.capacity(), 32U);
+  ASSERT_EQ(buffer.size(), 18U);
+  for (int i = 0; i < 18; ++i) {
+    EXPECT_EQ(buffer[i], std::to_string(i + 2));
+  }
+  EXPECT_THROW(buffer.at(18), std::out_of_range);
+}
+
+TEST(TestQueue, RingBufferSwap) {
+  s21::queue<std::string> queue1{"a", "b", "c"};
+  s21::queue<std::string> queue2;
+  queue2.insert_many_back("x", "y");
+  queue1.pop();
+  queue1.swap(queue2);
+
+  EXPECT_EQ(queue1.size(), 2);
+  EXPECT_EQ(queue1.front(), "x");
+  EXPECT_EQ(queue2.front(), "b");
+  EXPECT_EQ(queue2.back(), "c");
+}
+
+TEST(TestQueue, ListContainer) {
+  s21::queue<int, s21::list<int>> queue{1, 2, 3};
+  queue.push(4);
+  queue.pop();
+
+  EXPECT_EQ(queue.size(), 3);
+  EXPECT_EQ(queue.front(), 2);
+  EXPECT_EQ(queue.back(), 4);
+}
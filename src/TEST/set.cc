@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <set>
+#include <string>
+#include <string_view>
 
 #include "../s21_container.h"
 
@@ -307,4 +310,53 @@ TEST(INSERT_MANY, Set34) {
   EXPECT_TRUE(MySet1.contains('f'));
 }
 
+TEST(COMPARE, Set35) {
+  s21::set<int, std::greater<int>> MySet1{3, 1, 2};
+  MySet1.insert(5);
+  EXPECT_FALSE(MySet1.insert(2).second);
+  std::set<int, std::greater<int>> Set1{3, 1, 2, 5};
+  EXPECT_EQ(MySet1.size(), Set1.size());
+  auto it = Set1.begin();
+  for (auto item : MySet1) EXPECT_EQ(item, *it++);
+}
+
+TEST(COMPARE, Set36) {
+  s21::set<std::string, std::less<>> MySet1{"pear", "apple", "plum"};
+  std::string_view key = "apple";
+  EXPECT_TRUE(MySet1.contains(key));
+  EXPECT_EQ(*MySet1.find(key), "apple");
+  EXPECT_TRUE(MySet1.find(std::string_view("fig")) == MySet1.end());
+}
+
+TEST(TREE, Set37) {
+  s21::set<int> MySet;
+  std::set<int> Set;
+  unsigned state = 777;
+  for (int i = 0; i < 100000; ++i) {
+    state = state * 1103515245 + 12345;
+    int key = static_cast<int>(state >> 16) % 5000;
+    if (i % 3 == 2) {
+      MySet.erase(key);
+      Set.erase(key);
+    } else {
+      EXPECT_EQ(MySet.insert(key).second, Set.insert(key).second);
+    }
+  }
+  EXPECT_EQ(MySet.size(), Set.size());
+  auto it = Set.begin();
+  for (auto item : MySet) EXPECT_EQ(item, *it++);
+}
+
+TEST(MERGE, Set38) {
+  s21::set<int> MySet1{1, 2, 3};
+  s21::set<int> MySet2{3, 4, 5};
+  const int *four = &*MySet2.find(4);
+  MySet1.merge(MySet2);
+  EXPECT_EQ(MySet1.size(), 5U);
+  EXPECT_EQ(MySet2.size(), 1U);
+  EXPECT_EQ(*MySet2.begin(), 3);
+  // merged elements keep their nodes
+  EXPECT_EQ(&*MySet1.find(4), four);
+}
+
 // g++ set.cc -o test -lgtest -pthread
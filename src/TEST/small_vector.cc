@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../Vector/s21_small_vector.h"
+
+namespace {
+// Copying throws once copies_left runs out; the move constructor is not
+// noexcept, so growth has to copy.
+struct small_vector_fragile {
+  explicit small_vector_fragile(int v) : value(v) { ++alive; }
+  small_vector_fragile(const small_vector_fragile& other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    ++alive;
+  }
+  small_vector_fragile(small_vector_fragile&& other) : value(other.value) {
+    ++alive;
+  }
+  ~small_vector_fragile() { --alive; }
+
+  int value;
+  static int alive;
+  static int copies_left;
+};
+
+int small_vector_fragile::alive = 0;
+int small_vector_fragile::copies_left = 0;
+}  // namespace
+
+TEST(small_vector_constructor, case1) {
+  s21::small_vector<int, 8> s21_vec_int;
+  s21::small_vector<std::string, 4> s21_vec_string(3);
+
+  EXPECT_EQ(s21_vec_int.size(), 0U);
+  EXPECT_EQ(s21_vec_int.capacity(), 8U);
+  EXPECT_TRUE(s21_vec_int.is_inline());
+
+  EXPECT_EQ(s21_vec_string.size(), 3U);
+  EXPECT_EQ(s21_vec_string.capacity(), 4U);
+  EXPECT_TRUE(s21_vec_string.is_inline());
+  EXPECT_EQ(s21_vec_string[2], "");
+}
+
+TEST(small_vector_constructor, case2) {
+  s21::small_vector<std::string, 2> s21_vec_ref{"Hello", ",", "world", "!"};
+  s21::small_vector<std::string, 2> s21_vec_copy(s21_vec_ref);
+  s21::small_vector<std::string, 2> s21_vec_moved(std::move(s21_vec_ref));
+
+  EXPECT_FALSE(s21_vec_copy.is_inline());
+  EXPECT_EQ(s21_vec_copy.size(), 4U);
+  EXPECT_EQ(s21_vec_copy[2], "world");
+  EXPECT_EQ(s21_vec_moved.size(), 4U);
+  EXPECT_EQ(s21_vec_moved.back(), "!");
+  EXPECT_EQ(s21_vec_ref.size(), 0U);
+  EXPECT_TRUE(s21_vec_ref.is_inline());
+}
+
+TEST(small_vector_constructor, case3) {
+  s21::small_vector<std::string, 4> s21_vec_ref{"a", "b"};
+  s21::small_vector<std::string, 4> s21_vec_res{"c", "d", "e"};
+
+  s21_vec_res = std::move(s21_vec_ref);
+
+  EXPECT_EQ(s21_vec_res.size(), 2U);
+  EXPECT_EQ(s21_vec_res[0], "a");
+  EXPECT_EQ(s21_vec_res[1], "b");
+}
+
+TEST(small_vector_at, case1) {
+  s21::small_vector<int, 4> s21_vec_int{1, 4, 8, 9};
+
+  EXPECT_EQ(s21_vec_int.at(3), 9);
+  EXPECT_THROW(s21_vec_int.at(4), std::out_of_range);
+  EXPECT_EQ(s21_vec_int.front(), 1);
+  EXPECT_EQ(s21_vec_int.data(), s21_vec_int.begin());
+}
+
+TEST(small_vector_push_back, case1) {
+  s21::small_vector<int, 8> s21_vec_int;
+
+  for (int i = 0; i < 8; ++i) {
+    s21_vec_int.push_back(i);
+  }
+  EXPECT_TRUE(s21_vec_int.is_inline());
+  EXPECT_EQ(s21_vec_int.reallocation_count(), 0U);
+
+  s21_vec_int.push_back(8);
+  EXPECT_FALSE(s21_vec_int.is_inline());
+  EXPECT_EQ(s21_vec_int.capacity(), 16U);
+  for (int i = 0; i < 9; ++i) {
+    EXPECT_EQ(s21_vec_int[i], i);
+  }
+
+  s21_vec_int.pop_back();
+  s21_vec_int.shrink_to_fit();
+  EXPECT_TRUE(s21_vec_int.is_inline());
+  EXPECT_EQ(s21_vec_int.size(), 8U);
+  EXPECT_EQ(s21_vec_int.back(), 7);
+}
+
+TEST(small_vector_reserve, case1) {
+  s21::small_vector<std::string, 2> s21_vec_string{"x"};
+
+  s21_vec_string.reserve(1);
+  EXPECT_TRUE(s21_vec_string.is_inline());
+  s21_vec_string.reserve(10);
+  EXPECT_FALSE(s21_vec_string.is_inline());
+  EXPECT_EQ(s21_vec_string.capacity(), 10U);
+  EXPECT_EQ(s21_vec_string[0], "x");
+
+  s21_vec_string.clear();
+  EXPECT_TRUE(s21_vec_string.empty());
+  EXPECT_TRUE(s21_vec_string.is_inline());
+}
+
+TEST(small_vector_insert, case1) {
+  s21::small_vector<std::string, 4> s21_vec_string{"a", "d"};
+  std::vector<std::string> source{"b", "c"};
+
+  auto it = s21_vec_string.insert(s21_vec_string.begin() + 1, source.begin(),
+                                  source.end());
+  EXPECT_EQ(*it, "b");
+  EXPECT_TRUE(s21_vec_string.is_inline());
+
+  s21_vec_string.insert(s21_vec_string.begin(), s21_vec_string[3]);
+  s21_vec_string.insert(s21_vec_string.end(), 2, "e");
+
+  std::string expected[] = {"d", "a", "b", "c", "d", "e", "e"};
+  ASSERT_EQ(s21_vec_string.size(), 7U);
+  for (size_t i = 0; i < 7; ++i) {
+    EXPECT_EQ(s21_vec_string[i], expected[i]);
+  }
+}
+
+TEST(small_vector_insert_many, case1) {
+  s21::small_vector<int, 4> s21_vec_int{1, 2, 6};
+
+  auto it = s21_vec_int.insert_many(s21_vec_int.begin() + 2, 3, 4, 5);
+  EXPECT_EQ(*it, 6);
+
+  s21_vec_int.insert_many_back(7, 8);
+  s21_vec_int.emplace(s21_vec_int.begin(), 0);
+
+  ASSERT_EQ(s21_vec_int.size(), 9U);
+  for (int i = 0; i < 9; ++i) {
+    EXPECT_EQ(s21_vec_int[i], i);
+  }
+}
+
+TEST(small_vector_insert_many, case2) {
+  s21::small_vector<std::string, 4> s21_vec_inline{"a", "b"};
+  s21_vec_inline.insert_many(s21_vec_inline.begin(), s21_vec_inline[0],
+                             s21_vec_inline[1]);
+  ASSERT_EQ(s21_vec_inline.size(), 4U);
+  EXPECT_TRUE(s21_vec_inline.is_inline());
+  EXPECT_EQ(s21_vec_inline[0], "a");
+  EXPECT_EQ(s21_vec_inline[1], "b");
+  EXPECT_EQ(s21_vec_inline[2], "a");
+
+  s21::small_vector<std::string, 2> s21_vec_growing{"c", "d"};
+  s21_vec_growing.insert_many_back(s21_vec_growing[0]);
+  ASSERT_EQ(s21_vec_growing.size(), 3U);
+  EXPECT_FALSE(s21_vec_growing.is_inline());
+  EXPECT_EQ(s21_vec_growing[2], "c");
+}
+
+TEST(small_vector_reserve, case2) {
+  {
+    small_vector_fragile::copies_left = 100;
+    s21::small_vector<small_vector_fragile, 2> s21_vec;
+    s21_vec.emplace_back(1);
+    s21_vec.emplace_back(2);
+    s21_vec.reserve(4);
+    s21_vec.emplace_back(3);
+
+    small_vector_fragile::copies_left = 1;
+    EXPECT_THROW(s21_vec.reserve(16), std::runtime_error);
+    EXPECT_EQ(s21_vec.capacity(), 4U);
+    ASSERT_EQ(s21_vec.size(), 3U);
+    for (int i = 0; i < 3; ++i) {
+      EXPECT_EQ(s21_vec[i].value, i + 1);
+    }
+    EXPECT_EQ(small_vector_fragile::alive, 3);
+
+    small_vector_fragile::copies_left = 1;
+    EXPECT_THROW(s21_vec.shrink_to_fit(), std::runtime_error);
+    EXPECT_EQ(s21_vec.capacity(), 4U);
+    EXPECT_EQ(s21_vec[2].value, 3);
+    EXPECT_EQ(small_vector_fragile::alive, 3);
+  }
+  EXPECT_EQ(small_vector_fragile::alive, 0);
+}
+
+TEST(small_vector_erase, case1) {
+  s21::small_vector<std::string, 8> s21_vec_string{"a", "b", "c", "d", "e"};
+
+  auto it = s21_vec_string.erase(s21_vec_string.begin() + 1,
+                                 s21_vec_string.begin() + 3);
+  EXPECT_EQ(*it, "d");
+  s21_vec_string.erase(s21_vec_string.begin());
+
+  ASSERT_EQ(s21_vec_string.size(), 2U);
+  EXPECT_EQ(s21_vec_string[0], "d");
+  EXPECT_EQ(s21_vec_string[1], "e");
+}
+
+TEST(small_vector_swap, case1) {
+  s21::small_vector<std::string, 3> s21_vec_inline{"a", "b"};
+  s21::small_vector<std::string, 3> s21_vec_small{"c"};
+  s21::small_vector<std::string, 3> s21_vec_heap{"d", "e", "f", "g"};
+
+  s21_vec_inline.swap(s21_vec_small);
+  EXPECT_EQ(s21_vec_inline.size(), 1U);
+  EXPECT_EQ(s21_vec_inline[0], "c");
+  EXPECT_EQ(s21_vec_small.size(), 2U);
+  EXPECT_EQ(s21_vec_small[1], "b");
+
+  s21_vec_small.swap(s21_vec_heap);
+  EXPECT_FALSE(s21_vec_small.is_inline());
+  EXPECT_TRUE(s21_vec_heap.is_inline());
+  EXPECT_EQ(s21_vec_small.size(), 4U);
+  EXPECT_EQ(s21_vec_small[3], "g");
+  EXPECT_EQ(s21_vec_heap.size(), 2U);
+  EXPECT_EQ(s21_vec_heap[0], "a");
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Queue/s21_spsc_queue.h"
+
+TEST(spsc_queue, basic) {
+  s21::spsc_queue<int, 4> queue;
+  EXPECT_EQ(queue.capacity(), 4U);
+  EXPECT_TRUE(queue.empty());
+
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(queue.try_push(i));
+  EXPECT_FALSE(queue.try_push(4));
+  EXPECT_EQ(queue.size(), 4U);
+  EXPECT_EQ(queue.front(), 0);
+  queue.pop();
+  EXPECT_EQ(queue.front(), 1);
+
+  int value = -1;
+  for (int i = 1; i < 4; ++i) {
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(spsc_queue, wrap_around) {
+  s21::spsc_queue<std::string, 2> queue;
+  for (int i = 0; i < 20; ++i) {
+    queue.emplace(2, 'a' + i);
+    queue.push(std::to_string(i));
+    EXPECT_EQ(queue.front(), std::string(2, 'a' + i));
+    queue.pop();
+    EXPECT_EQ(queue.front(), std::to_string(i));
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(spsc_queue, bulk) {
+  s21::spsc_queue<int, 8> queue;
+  std::vector<int> items{1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(queue.push_bulk(items.begin(), items.end()), 6U);
+  EXPECT_EQ(queue.push_bulk(items.begin(), items.end()), 2U);
+
+  std::vector<int> out;
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(out), 5), 5U);
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(out), 5), 3U);
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(out), 5), 0U);
+  std::vector<int> expected{1, 2, 3, 4, 5, 6, 1, 2};
+  EXPECT_EQ(out, expected);
+}
+
+TEST(spsc_queue, destroys_leftovers) {
+  auto item = std::make_shared<int>(1);
+  {
+    s21::spsc_queue<std::shared_ptr<int>, 4> queue;
+    queue.push(item);
+    queue.push(item);
+    EXPECT_EQ(item.use_count(), 3);
+  }
+  EXPECT_EQ(item.use_count(), 1);
+}
+
+TEST(spsc_queue, two_threads) {
+  constexpr int kCount = 200000;
+  s21::spsc_queue<int, 64> queue;
+  bool ordered = true;
+  std::thread consumer([&queue, &ordered] {
+    int expected = 0;
+    std::vector<int> batch;
+    while (expected < kCount) {
+      int value;
+      if (expected % 2 == 0 && queue.try_pop(value)) {
+        ordered = ordered && value == expected;
+        ++expected;
+        continue;
+      }
+      batch.clear();
+      if (queue.pop_bulk(std::back_inserter(batch), 16) == 0) {
+        std::this_thread::yield();
+      }
+      for (int item : batch) {
+        ordered = ordered && item == expected;
+        ++expected;
+      }
+    }
+  });
+  std::vector<int> batch(8);
+  for (int i = 0; i < kCount;) {
+    if (i % 3 == 0) {
+      queue.push(i++);
+      continue;
+    }
+    int n = std::min(8, kCount - i);
+    for (int j = 0; j < n; ++j) batch[j] = i + j;
+    size_t pushed = queue.push_bulk(batch.begin(), batch.begin() + n);
+    if (pushed == 0) std::this_thread::yield();
+    i += static_cast<int>(pushed);
+  }
+  consumer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(queue.empty());
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <string>
+
 #include "../s21_container.h"
 
 TEST(ctors, default_ctor) {
@@ -117,3 +120,104 @@ TEST(overloads, move_assignment) {
     s2.pop();
   }
 }
+
+TEST(methods, emplace) {
+  s21::Stack<std::pair<int, std::string>> s;
+  s.emplace(1, "one");
+  s.emplace(2, "two");
+
+  EXPECT_EQ(s.size(), 2);
+  EXPECT_EQ(s.top().first, 2);
+  EXPECT_EQ(s.top().second, "two");
+  s.pop();
+  EXPECT_EQ(s.top().second, "one");
+}
+
+struct stack_allocation_stats {
+  int live = 0;
+};
+
+template <class T>
+struct stack_counting_allocator {
+  using value_type = T;
+
+  explicit stack_counting_allocator(stack_allocation_stats* s) : stats(s) {}
+  template <class U>
+  stack_counting_allocator(const stack_counting_allocator<U>& other)
+      : stats(other.stats) {}
+
+  T* allocate(size_t n) {
+    stats->live += n;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* ptr, size_t n) {
+    stats->live -= n;
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  template <class U>
+  bool operator==(const stack_counting_allocator<U>& other) const {
+    return stats == other.stats;
+  }
+  template <class U>
+  bool operator!=(const stack_counting_allocator<U>& other) const {
+    return stats != other.stats;
+  }
+
+  stack_allocation_stats* stats;
+};
+
+TEST(methods, allocator) {
+  using counted_vector = s21::vector<int, stack_counting_allocator<int>>;
+  stack_allocation_stats stats;
+  {
+    s21::Stack<int, counted_vector> s{
+        counted_vector(stack_counting_allocator<int>(&stats))};
+    s.reserve(10);
+    for (int i = 0; i < 10; ++i) {
+      s.push(i);
+    }
+    EXPECT_EQ(stats.live, 10);
+    s.pop();
+    EXPECT_EQ(stats.live, 10);
+
+    s21::Stack<int, counted_vector> copy(s);
+    EXPECT_EQ(stats.live, 19);
+    EXPECT_EQ(copy.top(), 8);
+  }
+  EXPECT_EQ(stats.live, 0);
+}
+
+TEST(methods, swap_keeps_buffers) {
+  s21::Stack<std::string> s1 = {"a", "b", "c"};
+  s21::Stack<std::string> s2 = {"x"};
+  const std::string* top1 = &s1.top();
+  const std::string* top2 = &s2.top();
+
+  s1.swap(s2);
+
+  EXPECT_EQ(&s1.top(), top2);
+  EXPECT_EQ(&s2.top(), top1);
+  EXPECT_EQ(s2.size(), 3);
+}
+
+TEST(overloads, move_assignment_releases) {
+  s21::Stack<std::string> s1 = {"a", "b"};
+  s21::Stack<std::string> s2 = {"x", "y", "z"};
+
+  s2 = std::move(s1);
+
+  EXPECT_EQ(s2.size(), 2);
+  EXPECT_EQ(s2.top(), "b");
+  EXPECT_TRUE(s1.empty());
+}
+
+TEST(methods, list_container) {
+  s21::Stack<int, s21::list<int>> s = {1, 2, 3};
+  s.push(4);
+  s.pop();
+  s.pop();
+
+  EXPECT_EQ(s.top(), 2);
+  EXPECT_EQ(s.size(), 2);
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../List/s21_unrolled_list.h"
+
+namespace {
+template <class List, class Expected>
+void ExpectSame(List& l, const Expected& expected) {
+  ASSERT_EQ(l.size(), expected.size());
+  auto it = l.begin();
+  for (const auto& item : expected) {
+    ASSERT_EQ(*it, item);
+    ++it;
+  }
+  EXPECT_TRUE(it == l.end());
+  // walk back as well to check the links in the other direction
+  for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit) {
+    --it;
+    ASSERT_EQ(*it, *rit);
+  }
+  EXPECT_TRUE(it == l.begin());
+}
+}  // namespace
+
+TEST(unrolled_list, constructors) {
+  s21::unrolled_list<int, 4> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.begin() == empty.end());
+
+  s21::unrolled_list<int, 4> sized(10);
+  ExpectSame(sized, std::vector<int>(10, 0));
+
+  s21::unrolled_list<std::string, 4> items{"a", "b", "c", "d", "e"};
+  s21::unrolled_list<std::string, 4> copy(items);
+  ExpectSame(copy, std::vector<std::string>{"a", "b", "c", "d", "e"});
+
+  s21::unrolled_list<std::string, 4> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.front(), "a");
+  EXPECT_EQ(moved.back(), "e");
+
+  copy = moved;
+  items = std::move(moved);
+  EXPECT_TRUE(moved.empty());
+  ExpectSame(items, std::vector<std::string>{"a", "b", "c", "d", "e"});
+  ExpectSame(copy, std::vector<std::string>{"a", "b", "c", "d", "e"});
+}
+
+TEST(unrolled_list, push_and_pop) {
+  s21::unrolled_list<int, 4> l;
+  std::list<int> expected;
+  for (int i = 0; i < 50; ++i) {
+    if (i % 3 == 0) {
+      l.push_front(i);
+      expected.push_front(i);
+    } else {
+      l.push_back(i);
+      expected.push_back(i);
+    }
+  }
+  ExpectSame(l, expected);
+  for (int i = 0; i < 20; ++i) {
+    if (i % 2 == 0) {
+      l.pop_front();
+      expected.pop_front();
+    } else {
+      l.pop_back();
+      expected.pop_back();
+    }
+  }
+  ExpectSame(l, expected);
+  l.clear();
+  EXPECT_TRUE(l.empty());
+  l.pop_back();
+  l.pop_front();
+  EXPECT_TRUE(l.empty());
+}
+
+TEST(unrolled_list, insert_and_erase) {
+  s21::unrolled_list<int, 4> l;
+  std::list<int> expected;
+  unsigned seed = 7;
+  for (int i = 0; i < 300; ++i) {
+    seed = seed * 1103515245 + 12345;
+    size_t at = l.empty() ? 0 : seed % (l.size() + 1);
+    auto it = l.begin();
+    auto eit = expected.begin();
+    for (size_t j = 0; j < at; ++j, ++it, ++eit) {
+    }
+    if (i % 4 == 3 && it != l.end()) {
+      l.erase(it);
+      expected.erase(eit);
+    } else {
+      auto inserted = l.insert(it, i);
+      EXPECT_EQ(*inserted, i);
+      expected.insert(eit, i);
+    }
+  }
+  ExpectSame(l, expected);
+}
+
+TEST(unrolled_list, emplace_and_insert_many) {
+  s21::unrolled_list<std::pair<int, std::string>, 2> l;
+  l.emplace_back(1, "one");
+  l.emplace_front(0, "zero");
+  l.emplace(--l.end(), 5, "five");
+  EXPECT_EQ(l.front().second, "zero");
+  EXPECT_EQ((*++l.begin()).first, 5);
+  EXPECT_EQ(l.back().first, 1);
+
+  s21::unrolled_list<int, 2> numbers{1, 5};
+  auto it = numbers.insert_many(++numbers.begin(), 2, 3, 4);
+  EXPECT_EQ(*it, 2);
+  numbers.insert_many_back(6, 7);
+  numbers.insert_many_front(-1, 0);
+  ExpectSame(numbers, std::vector<int>{0, -1, 1, 2, 3, 4, 5, 6, 7});
+}
+
+TEST(unrolled_list, splice) {
+  s21::unrolled_list<int, 4> l1{1, 2, 7, 8, 9};
+  s21::unrolled_list<int, 4> l2{3, 4, 5, 6};
+  auto pos = l1.begin();
+  ++pos;
+  ++pos;
+  l1.splice(pos, l2);
+  EXPECT_TRUE(l2.empty());
+  ExpectSame(l1, std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+  s21::unrolled_list<int, 4> l3{10, 11};
+  l1.splice(l1.end(), l3);
+  l3.push_back(0);
+  l1.splice(l1.begin(), l3);
+  ExpectSame(l1, std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+}
+
+TEST(unrolled_list, sort_and_merge) {
+  s21::unrolled_list<int, 4> l{5, 6, 4, 10, 8, 2, 3, 7, 9, 1};
+  l.sort();
+  ExpectSame(l, std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+  l.sort(std::greater<int>());
+  ExpectSame(l, std::vector<int>{10, 9, 8, 7, 6, 5, 4, 3, 2, 1});
+
+  s21::unrolled_list<std::pair<int, char>, 4> a{{1, 'a'}, {3, 'a'}, {5, 'a'}};
+  s21::unrolled_list<std::pair<int, char>, 4> b{{1, 'b'}, {2, 'b'}, {6, 'b'}};
+  a.merge(b, [](const std::pair<int, char>& x, const std::pair<int, char>& y) {
+    return x.first < y.first;
+  });
+  EXPECT_TRUE(b.empty());
+  std::string order;
+  for (const auto& item : a) order += std::to_string(item.first) + item.second;
+  EXPECT_EQ(order, "1a1b2b3a5a6b");
+
+  s21::unrolled_list<int, 4> c{1, 3};
+  s21::unrolled_list<int, 4> d{2, 4};
+  c.merge(d);
+  ExpectSame(c, std::vector<int>{1, 2, 3, 4});
+}
+
+TEST(unrolled_list, reverse_and_unique) {
+  s21::unrolled_list<int, 4> l;
+  std::vector<int> expected;
+  for (int i = 0; i < 11; ++i) l.push_back(i);
+  l.reverse();
+  for (int i = 10; i >= 0; --i) expected.push_back(i);
+  ExpectSame(l, expected);
+
+  s21::unrolled_list<int, 4> dups{1, 1, 1, 2, 3, 3, 4, 4, 4, 4, 4, 5, 1, 1};
+  dups.unique();
+  ExpectSame(dups, std::vector<int>{1, 2, 3, 4, 5, 1});
+  dups.unique([](int a, int b) { return b - a == 1; });
+  ExpectSame(dups, std::vector<int>{1, 3, 5, 1});
+  dups.push_back(9);
+  EXPECT_EQ(dups.back(), 9);
+}
+
+TEST(unrolled_list, destroys_elements) {
+  auto item = std::make_shared<int>(1);
+  {
+    s21::unrolled_list<std::shared_ptr<int>, 3> l;
+    for (int i = 0; i < 10; ++i) l.push_back(item);
+    EXPECT_EQ(item.use_count(), 11);
+    l.erase(l.begin());
+    l.unique();
+    EXPECT_EQ(item.use_count(), 2);
+    for (int i = 0; i < 10; ++i) l.push_front(item);
+  }
+  EXPECT_EQ(item.use_count(), 1);
+}
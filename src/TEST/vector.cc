@@ -1,7 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
+#include "../Vector/s21_vector.h"
 #include "../s21_container.h"
 
 TEST(vector_constructor, case1) {
@@ -612,3 +617,460 @@ TEST(Vector_Insert_Many, Insert_Many_Back) {
   EXPECT_EQ(int_temp[6] == 4, 1);
   EXPECT_EQ(int_temp[5] == 3, 1);
 }
+
+TEST(Vector_Insert_Many, Own_Elements) {
+  s21::vector<std::string> in_place{"a", "b"};
+  in_place.reserve(10);
+  in_place.insert_many(in_place.begin(), in_place[0], in_place[1]);
+  EXPECT_EQ(in_place.size(), 4U);
+  EXPECT_EQ(in_place[0], "a");
+  EXPECT_EQ(in_place[1], "b");
+  EXPECT_EQ(in_place[2], "a");
+  EXPECT_EQ(in_place[3], "b");
+
+  s21::vector<std::string> growing{"a", "b"};
+  growing.shrink_to_fit();
+  growing.insert_many_back(growing[0], std::string("c"), growing[1]);
+  EXPECT_EQ(growing.size(), 5U);
+  EXPECT_EQ(growing[2], "a");
+  EXPECT_EQ(growing[3], "c");
+  EXPECT_EQ(growing[4], "b");
+}
+
+TEST(vector_growth, case1) {
+  s21::vector<int> s21_vec_int;
+
+  for (int i = 0; i < 1000; ++i) {
+    s21_vec_int.push_back(i);
+  }
+
+  EXPECT_EQ(s21_vec_int.size(), 1000U);
+  EXPECT_EQ(s21_vec_int.capacity(), 1024U);
+  EXPECT_EQ(s21_vec_int.reallocation_count(), 11U);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(s21_vec_int[i], i);
+  }
+}
+
+TEST(vector_growth, case2) {
+  s21::vector<std::string, std::allocator<std::string>, s21::growth_factor_1_5>
+      s21_vec_string{"a", "b"};
+
+  s21_vec_string.push_back("c");
+  EXPECT_EQ(s21_vec_string.capacity(), 3U);
+  s21_vec_string.push_back("d");
+  EXPECT_EQ(s21_vec_string.capacity(), 4U);
+  s21_vec_string.push_back("e");
+  EXPECT_EQ(s21_vec_string.capacity(), 6U);
+  EXPECT_EQ(s21_vec_string.reallocation_count(), 3U);
+  EXPECT_EQ(s21_vec_string[4], "e");
+}
+
+struct fixed_step_growth {
+  size_t operator()(size_t capacity, size_t required) const {
+    return capacity + 16 < required ? required : capacity + 16;
+  }
+};
+
+TEST(vector_growth, case3) {
+  s21::vector<double, std::allocator<double>, fixed_step_growth>
+      s21_vec_double;
+
+  for (int i = 0; i < 40; ++i) {
+    s21_vec_double.push_back(i * 0.5);
+  }
+
+  EXPECT_EQ(s21_vec_double.capacity(), 48U);
+  EXPECT_EQ(s21_vec_double.reallocation_count(), 3U);
+  EXPECT_EQ(s21_vec_double.back(), 19.5);
+}
+
+TEST(vector_growth, case4) {
+  s21::vector<int> s21_vec_int{1, 2, 3};
+
+  s21_vec_int.reserve(100);
+  for (int i = 0; i < 97; ++i) {
+    s21_vec_int.push_back(i);
+  }
+  s21_vec_int.push_back(97);
+
+  EXPECT_EQ(s21_vec_int.capacity(), 200U);
+  EXPECT_EQ(s21_vec_int.reallocation_count(), 2U);
+}
+
+struct vector_tracked {
+  static int alive;
+  static int copies;
+  static int moves;
+
+  vector_tracked(int v = 0) : value(v) { ++alive; }
+  vector_tracked(const vector_tracked& other) : value(other.value) {
+    ++alive;
+    ++copies;
+  }
+  vector_tracked(vector_tracked&& other) noexcept : value(other.value) {
+    ++alive;
+    ++moves;
+  }
+  vector_tracked& operator=(const vector_tracked& other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  vector_tracked& operator=(vector_tracked&& other) noexcept {
+    value = other.value;
+    ++moves;
+    return *this;
+  }
+  ~vector_tracked() { --alive; }
+
+  static void reset() { alive = copies = moves = 0; }
+
+  int value;
+};
+
+int vector_tracked::alive = 0;
+int vector_tracked::copies = 0;
+int vector_tracked::moves = 0;
+
+TEST(vector_storage, case1) {
+  vector_tracked::reset();
+  {
+    s21::vector<vector_tracked> s21_vec;
+    s21_vec.reserve(100);
+    EXPECT_EQ(vector_tracked::alive, 0);
+
+    s21::vector<vector_tracked> s21_vec_sized(5);
+    EXPECT_EQ(vector_tracked::alive, 5);
+  }
+  EXPECT_EQ(vector_tracked::alive, 0);
+}
+
+TEST(vector_storage, case2) {
+  vector_tracked::reset();
+  {
+    s21::vector<vector_tracked> s21_vec;
+    for (int i = 0; i < 100; ++i) {
+      vector_tracked item(i);
+      s21_vec.push_back(item);
+    }
+    EXPECT_EQ(vector_tracked::copies, 100);
+
+    vector_tracked::copies = 0;
+    s21_vec.reserve(1000);
+    s21_vec.shrink_to_fit();
+    s21_vec.insert(s21_vec.begin() + 10, vector_tracked(-1));
+    s21_vec.erase(s21_vec.begin());
+    EXPECT_EQ(vector_tracked::copies, 1);
+    EXPECT_EQ(s21_vec[9].value, -1);
+    EXPECT_EQ(s21_vec[10].value, 10);
+    EXPECT_EQ(vector_tracked::alive, 100);
+  }
+  EXPECT_EQ(vector_tracked::alive, 0);
+}
+
+struct vector_throwing_move {
+  vector_throwing_move() = default;
+  vector_throwing_move(const vector_throwing_move&) { ++copies; }
+  vector_throwing_move(vector_throwing_move&&) {}
+
+  static int copies;
+};
+
+int vector_throwing_move::copies = 0;
+
+TEST(vector_storage, case3) {
+  s21::vector<vector_throwing_move> s21_vec(4);
+
+  vector_throwing_move::copies = 0;
+  s21_vec.reserve(8);
+
+  EXPECT_EQ(vector_throwing_move::copies, 4);
+}
+
+TEST(vector_storage, case4) {
+  s21::vector<std::string> s21_vec_string{"Hello", ",", "world"};
+
+  s21_vec_string.push_back(s21_vec_string[0]);
+  s21_vec_string.insert(s21_vec_string.begin(), s21_vec_string[2]);
+
+  EXPECT_EQ(s21_vec_string.size(), 5U);
+  EXPECT_EQ(s21_vec_string[0], "world");
+  EXPECT_EQ(s21_vec_string[4], "Hello");
+}
+
+TEST(vector_emplace, case1) {
+  s21::vector<std::pair<int, std::string>> s21_vec;
+
+  s21_vec.emplace_back(1, "one");
+  s21_vec.emplace_back(3, "three");
+  auto it = s21_vec.emplace(s21_vec.begin() + 1, 2, "two");
+
+  EXPECT_EQ(it, s21_vec.begin() + 1);
+  EXPECT_EQ(s21_vec.size(), 3U);
+  EXPECT_EQ(s21_vec[0].second, "one");
+  EXPECT_EQ(s21_vec[1].second, "two");
+  EXPECT_EQ(s21_vec[2].second, "three");
+}
+
+TEST(vector_emplace, case2) {
+  vector_tracked::reset();
+  {
+    s21::vector<vector_tracked> s21_vec;
+    for (int i = 0; i < 100; ++i) {
+      s21_vec.emplace_back(i);
+    }
+    s21_vec.emplace(s21_vec.begin(), -1);
+    s21_vec.insert_many_back(100, 101);
+
+    EXPECT_EQ(vector_tracked::copies, 0);
+    EXPECT_EQ(s21_vec.size(), 103U);
+    EXPECT_EQ(s21_vec.front().value, -1);
+    EXPECT_EQ(s21_vec.back().value, 101);
+  }
+  EXPECT_EQ(vector_tracked::alive, 0);
+}
+
+TEST(vector_emplace, case3) {
+  s21::vector<std::string> s21_vec_string{"Hello", "world"};
+
+  s21_vec_string.emplace_back(s21_vec_string[0]);
+  s21_vec_string.emplace(s21_vec_string.begin(), 3, '!');
+
+  EXPECT_EQ(s21_vec_string.size(), 4U);
+  EXPECT_EQ(s21_vec_string[0], "!!!");
+  EXPECT_EQ(s21_vec_string[3], "Hello");
+}
+
+TEST(vector_insert_range, case1) {
+  s21::vector<int> s21_vec_int{1, 2, 6};
+  std::vector<int> std_vec_int{1, 2, 6};
+
+  auto it = s21_vec_int.insert(s21_vec_int.begin() + 2, 3, 9);
+  std_vec_int.insert(std_vec_int.begin() + 2, 3, 9);
+
+  EXPECT_EQ(it, s21_vec_int.begin() + 2);
+  ASSERT_EQ(s21_vec_int.size(), std_vec_int.size());
+  for (size_t i = 0; i < std_vec_int.size(); ++i) {
+    EXPECT_EQ(s21_vec_int[i], std_vec_int[i]);
+  }
+}
+
+TEST(vector_insert_range, case2) {
+  s21::vector<std::string> s21_vec_string{"a", "e"};
+  s21::list<std::string> s21_list_string{"b", "c", "d"};
+
+  s21_vec_string.reserve(10);
+  auto it = s21_vec_string.insert(s21_vec_string.begin() + 1,
+                                  s21_list_string.begin(),
+                                  s21_list_string.end());
+
+  EXPECT_EQ(*it, "b");
+  EXPECT_EQ(s21_vec_string.size(), 5U);
+  EXPECT_EQ(s21_vec_string.reallocation_count(), 1U);
+  std::string expected[] = {"a", "b", "c", "d", "e"};
+  for (size_t i = 0; i < 5; ++i) {
+    EXPECT_EQ(s21_vec_string[i], expected[i]);
+  }
+}
+
+TEST(vector_insert_range, case3) {
+  s21::vector<int> s21_vec_int{1, 5};
+  std::istringstream input("2 3 4");
+
+  s21_vec_int.insert(s21_vec_int.begin() + 1,
+                     std::istream_iterator<int>(input),
+                     std::istream_iterator<int>());
+
+  EXPECT_EQ(s21_vec_int.size(), 5U);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(s21_vec_int[i], i + 1);
+  }
+}
+
+TEST(vector_insert_range, case4) {
+  s21::vector<int> s21_vec_int;
+  for (int i = 0; i < 1024; ++i) {
+    s21_vec_int.push_back(i);
+  }
+  size_t reallocations = s21_vec_int.reallocation_count();
+
+  s21_vec_int.insert_many(s21_vec_int.begin(), -5, -4, -3, -2, -1);
+
+  EXPECT_EQ(s21_vec_int.reallocation_count(), reallocations + 1);
+  EXPECT_EQ(s21_vec_int.size(), 1029U);
+  for (int i = 0; i < 1029; ++i) {
+    EXPECT_EQ(s21_vec_int[i], i - 5);
+  }
+}
+
+TEST(vector_insert_range, case5) {
+  s21::vector<std::string> s21_vec_string{"x", "y"};
+
+  s21_vec_string.insert(s21_vec_string.begin(), 3, s21_vec_string[1]);
+  s21_vec_string.insert(s21_vec_string.end(), 0, "z");
+
+  EXPECT_EQ(s21_vec_string.size(), 5U);
+  EXPECT_EQ(s21_vec_string[0], "y");
+  EXPECT_EQ(s21_vec_string[2], "y");
+  EXPECT_EQ(s21_vec_string[3], "x");
+}
+
+TEST(vector_erase, case3) {
+  s21::vector<std::string> s21_vec_string{"a", "b", "c", "d", "e", "f"};
+
+  auto it = s21_vec_string.erase(s21_vec_string.begin() + 1,
+                                 s21_vec_string.begin() + 4);
+
+  EXPECT_EQ(*it, "e");
+  EXPECT_EQ(s21_vec_string.size(), 3U);
+  EXPECT_EQ(s21_vec_string.capacity(), 6U);
+  EXPECT_EQ(s21_vec_string[0], "a");
+  EXPECT_EQ(s21_vec_string[1], "e");
+  EXPECT_EQ(s21_vec_string[2], "f");
+
+  it = s21_vec_string.erase(s21_vec_string.begin() + 2);
+  EXPECT_EQ(it, s21_vec_string.end());
+  it = s21_vec_string.erase(s21_vec_string.begin(), s21_vec_string.begin());
+  EXPECT_EQ(*it, "a");
+  EXPECT_EQ(s21_vec_string.size(), 2U);
+}
+
+TEST(vector_erase, case4) {
+  s21::vector<int> s21_vec_int;
+  for (int i = 0; i < 100; ++i) {
+    s21_vec_int.push_back(i);
+  }
+  size_t capacity = s21_vec_int.capacity();
+
+  auto removed = s21::erase_if(s21_vec_int, [](int x) { return x % 3 != 0; });
+
+  EXPECT_EQ(removed, 66U);
+  EXPECT_EQ(s21_vec_int.size(), 34U);
+  EXPECT_EQ(s21_vec_int.capacity(), capacity);
+  for (int i = 0; i < 34; ++i) {
+    EXPECT_EQ(s21_vec_int[i], i * 3);
+  }
+}
+
+TEST(vector_erase, case5) {
+  vector_tracked::reset();
+  {
+    s21::vector<vector_tracked> s21_vec;
+    for (int i = 0; i < 10; ++i) {
+      s21_vec.emplace_back(i);
+    }
+    s21::erase_if(s21_vec, [](const vector_tracked& x) { return x.value < 5; });
+    s21_vec.erase(s21_vec.begin());
+
+    EXPECT_EQ(vector_tracked::alive, 4);
+    EXPECT_EQ(vector_tracked::copies, 0);
+    EXPECT_EQ(s21_vec.front().value, 6);
+  }
+  EXPECT_EQ(vector_tracked::alive, 0);
+}
+
+TEST(vector_trivial_copy, case1) {
+  s21::vector<double> s21_vec_double;
+  for (int i = 0; i < 1000; ++i) {
+    s21_vec_double.push_back(i * 0.25);
+  }
+  s21_vec_double.insert(s21_vec_double.begin() + 500, 2, -1.0);
+
+  s21::vector<double> s21_vec_copy(s21_vec_double);
+  s21_vec_double.reserve(5000);
+  s21_vec_double.shrink_to_fit();
+
+  EXPECT_EQ(s21_vec_double.capacity(), 1002U);
+  ASSERT_EQ(s21_vec_copy.size(), 1002U);
+  for (int i = 0; i < 1002; ++i) {
+    double expected = i < 500 ? i * 0.25 : i < 502 ? -1.0 : (i - 2) * 0.25;
+    EXPECT_EQ(s21_vec_double[i], expected);
+    EXPECT_EQ(s21_vec_copy[i], expected);
+  }
+}
+
+struct vector_allocation_stats {
+  int total = 0;
+  int live = 0;
+};
+
+template <class T>
+struct vector_counting_allocator {
+  using value_type = T;
+
+  explicit vector_counting_allocator(vector_allocation_stats* s) : stats(s) {}
+  template <class U>
+  vector_counting_allocator(const vector_counting_allocator<U>& other)
+      : stats(other.stats) {}
+
+  T* allocate(size_t n) {
+    ++stats->total;
+    ++stats->live;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* ptr, size_t n) {
+    --stats->live;
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  template <class U>
+  bool operator==(const vector_counting_allocator<U>& other) const {
+    return stats == other.stats;
+  }
+  template <class U>
+  bool operator!=(const vector_counting_allocator<U>& other) const {
+    return stats != other.stats;
+  }
+
+  vector_allocation_stats* stats;
+};
+
+TEST(vector_allocator, case1) {
+  vector_allocation_stats stats;
+  {
+    vector_counting_allocator<std::string> alloc(&stats);
+    s21::vector<std::string, vector_counting_allocator<std::string>> s21_vec(
+        alloc);
+    for (int i = 0; i < 100; ++i) {
+      s21_vec.push_back(std::to_string(i));
+    }
+    EXPECT_EQ(stats.total, static_cast<int>(s21_vec.reallocation_count()));
+    EXPECT_EQ(stats.live, 1);
+    EXPECT_EQ(s21_vec.get_allocator().stats, &stats);
+
+    s21_vec.insert(s21_vec.begin() + 50, 3, "x");
+    s21_vec.erase(s21_vec.begin(), s21_vec.begin() + 10);
+    s21_vec.shrink_to_fit();
+    EXPECT_EQ(s21_vec.size(), 93U);
+    EXPECT_EQ(s21_vec[40], "x");
+  }
+  EXPECT_EQ(stats.live, 0);
+}
+
+TEST(vector_allocator, case2) {
+  vector_allocation_stats stats_a;
+  vector_allocation_stats stats_b;
+  {
+    using counted_vector = s21::vector<int, vector_counting_allocator<int>>;
+    counted_vector s21_vec_a{vector_counting_allocator<int>(&stats_a)};
+    counted_vector s21_vec_b{vector_counting_allocator<int>(&stats_b)};
+    s21_vec_a.insert_many_back(1, 2, 3);
+    s21_vec_b.insert_many_back(4, 5);
+
+    counted_vector s21_vec_copy(s21_vec_a);
+    EXPECT_EQ(s21_vec_copy.get_allocator().stats, &stats_a);
+    EXPECT_EQ(stats_a.live, 2);
+
+    // the allocator does not propagate on move assignment, so the elements
+    // are moved into memory from b's allocator
+    s21_vec_b = std::move(s21_vec_a);
+    EXPECT_EQ(s21_vec_b.get_allocator().stats, &stats_b);
+    EXPECT_EQ(s21_vec_b.size(), 3U);
+    EXPECT_EQ(s21_vec_b[2], 3);
+    EXPECT_EQ(stats_a.live, 1);
+    EXPECT_EQ(stats_b.live, 1);
+  }
+  EXPECT_EQ(stats_a.live, 0);
+  EXPECT_EQ(stats_b.live, 0);
+}
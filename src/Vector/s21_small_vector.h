@@ -0,0 +1,409 @@
+#ifndef S21_SMALL_VECTOR_H
+#define S21_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+#include "s21_vector_base.h"
+
+namespace s21 {
+// vector with room for N elements inside the object itself: the heap is only
+// touched once the size grows past N, and then through Allocator. Offers the
+// same interface as vector.
+template <class T, size_t N, class Allocator = std::allocator<T>,
+          class Growth = growth_factor_2>
+class small_vector
+    : public s21_VectorBase<T, Allocator, Growth,
+                            small_vector<T, N, Allocator, Growth>> {
+  static_assert(N > 0, "small_vector needs at least one inline slot");
+  static_assert(std::is_same_v<typename Allocator::value_type, T>,
+                "Allocator::value_type must be T");
+  static_assert(std::is_invocable_r_v<size_t, const Growth&, size_t, size_t>,
+                "Growth must map (capacity, required) to a new capacity");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  small_vector() : small_vector(Allocator()){};
+  explicit small_vector(const Allocator& alloc)
+      : base_type(alloc) {
+    data_ = Inline();
+    capacity_ = N;
+  };
+  small_vector(size_type n);
+  small_vector(std::initializer_list<value_type> const& items);
+  small_vector(const small_vector& v);
+  small_vector(small_vector&& v);
+
+  ~small_vector();
+
+  small_vector& operator=(small_vector&& v);
+
+  allocator_type get_allocator() { return alloc_; };
+
+  reference at(size_type pos);
+  reference operator[](size_type pos) { return data_[pos]; };
+  const_reference front() { return *data_; };
+  const_reference back() { return data_[size_ - 1]; };
+  T* data() { return data_; };
+
+  iterator begin() { return data_; };
+  iterator end() { return data_ + size_; };
+
+  bool empty() { return size_ == 0; };
+  size_type size() { return size_; };
+  size_type max_size();
+  void reserve(size_type size);
+  size_type capacity() { return capacity_; };
+  size_type reallocation_count() { return reallocations_; };
+  bool is_inline() { return data_ == Inline(); };
+  void shrink_to_fit();
+
+  void clear();
+  iterator insert(iterator pos, const_reference value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  void pop_back();
+  void swap(small_vector& other);
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args&&... args);
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+ private:
+  using base_type = s21_VectorBase<T, Allocator, Growth, small_vector>;
+  friend base_type;
+  using typename base_type::alloc_traits;
+  using base_type::alloc_;
+  using base_type::capacity_;
+  using base_type::data_;
+  using base_type::reallocations_;
+  using base_type::size_;
+  using base_type::Construct;
+  using base_type::ConstructN;
+  using base_type::ConstructRange;
+  using base_type::Destroy;
+  using base_type::MoveToBuffer;
+  using base_type::Relocate;
+
+  alignas(T) unsigned char inline_[N * sizeof(T)];
+
+  T* Inline() { return reinterpret_cast<T*>(inline_); }
+  T* Allocate(size_type n);
+  void Release();
+  void SwapStorage(small_vector& other);
+  void MoveTo(size_type new_capacity, size_type gap_pos, size_type gap_size);
+};
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+small_vector<T, N, Allocator, Growth>::small_vector(size_type n)
+    : small_vector() {
+  reserve(n);
+  ConstructN(data_, n);
+  size_ = n;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+small_vector<T, N, Allocator, Growth>::small_vector(
+    std::initializer_list<value_type> const& items)
+    : small_vector() {
+  insert(begin(), items.begin(), items.end());
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+small_vector<T, N, Allocator, Growth>::small_vector(const small_vector& v)
+    : small_vector(
+          alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+  reserve(v.size_);
+  ConstructRange(v.data_, v.data_ + v.size_, data_);
+  size_ = v.size_;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+small_vector<T, N, Allocator, Growth>::small_vector(small_vector&& v)
+    : small_vector(v.alloc_) {
+  SwapStorage(v);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+small_vector<T, N, Allocator, Growth>::~small_vector() {
+  Destroy(data_, data_ + size_);
+  Release();
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+small_vector<T, N, Allocator, Growth>&
+small_vector<T, N, Allocator, Growth>::operator=(small_vector&& v) {
+  if (this == &v) return *this;
+  clear();
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    alloc_ = v.alloc_;
+  }
+  if (alloc_ == v.alloc_) {
+    SwapStorage(v);
+  } else {
+    reserve(v.size_);
+    for (T* it = v.data_; it != v.data_ + v.size_; ++it) {
+      Construct(data_ + size_, std::move(*it));
+      ++size_;
+    }
+    v.clear();
+  }
+  return *this;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename small_vector<T, N, Allocator, Growth>::reference
+small_vector<T, N, Allocator, Growth>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out range");
+  }
+  return data_[pos];
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename small_vector<T, N, Allocator, Growth>::size_type
+small_vector<T, N, Allocator, Growth>::max_size() {
+  return base_type::MaxSize();
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void small_vector<T, N, Allocator, Growth>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("Can't allocate memory of this size");
+  }
+  if (size > capacity_) {
+    MoveTo(size, size_, 0);
+  }
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void small_vector<T, N, Allocator, Growth>::shrink_to_fit() {
+  if (!is_inline() && size_ != capacity_) {
+    MoveTo(size_ <= N ? N : size_, size_, 0);
+  }
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void small_vector<T, N, Allocator, Growth>::clear() {
+  Destroy(data_, data_ + size_);
+  size_ = 0;
+  Release();
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename small_vector<T, N, Allocator, Growth>::iterator
+small_vector<T, N, Allocator, Growth>::insert(iterator pos,
+                                              const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename small_vector<T, N, Allocator, Growth>::iterator
+small_vector<T, N, Allocator, Growth>::insert(const_iterator pos,
+                                              size_type count,
+                                              const_reference value) {
+  return this->InsertCopies(pos - begin(), count, value);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename InputIt, typename>
+typename small_vector<T, N, Allocator, Growth>::iterator
+small_vector<T, N, Allocator, Growth>::insert(const_iterator pos,
+                                              InputIt first, InputIt last) {
+  return this->InsertRange(pos - begin(), first, last);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename small_vector<T, N, Allocator, Growth>::iterator
+small_vector<T, N, Allocator, Growth>::erase(const_iterator pos) {
+  return erase(pos, pos + 1);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename small_vector<T, N, Allocator, Growth>::iterator
+small_vector<T, N, Allocator, Growth>::erase(const_iterator first,
+                                             const_iterator last) {
+  return this->EraseRange(data_ + (first - data_), data_ + (last - data_));
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void small_vector<T, N, Allocator, Growth>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void small_vector<T, N, Allocator, Growth>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void small_vector<T, N, Allocator, Growth>::pop_back() {
+  size_ -= 1;
+  Destroy(data_ + size_, data_ + size_ + 1);
+}
+
+// Allocators are exchanged only when they propagate on swap; otherwise they
+// must compare equal.
+template <typename T, size_t N, typename Allocator, typename Growth>
+void small_vector<T, N, Allocator, Growth>::swap(small_vector& other) {
+  if (this == &other) return;
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+  SwapStorage(other);
+}
+
+// Heap buffers trade pointers; inline elements have to be moved one by one.
+template <typename T, size_t N, typename Allocator, typename Growth>
+void small_vector<T, N, Allocator, Growth>::SwapStorage(small_vector& other) {
+  std::swap(reallocations_, other.reallocations_);
+  if (!is_inline() && !other.is_inline()) {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    return;
+  }
+  small_vector& small = is_inline() ? *this : other;
+  small_vector& large = is_inline() ? other : *this;
+  if (!large.is_inline()) {
+    // small becomes the heap owner, large takes over small's elements inline
+    T* heap = large.data_;
+    size_type heap_size = large.size_;
+    size_type heap_capacity = large.capacity_;
+    large.data_ = large.Inline();
+    large.capacity_ = N;
+    Relocate(small.data_, small.data_ + small.size_, large.data_);
+    large.size_ = small.size_;
+    small.data_ = heap;
+    small.size_ = heap_size;
+    small.capacity_ = heap_capacity;
+    return;
+  }
+  size_type common = std::min(size_, other.size_);
+  std::swap_ranges(data_, data_ + common, other.data_);
+  small_vector& longer = size_ > other.size_ ? *this : other;
+  small_vector& shorter = size_ > other.size_ ? other : *this;
+  Relocate(longer.data_ + common, longer.data_ + longer.size_,
+           shorter.data_ + common);
+  std::swap(size_, other.size_);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename... Args>
+typename small_vector<T, N, Allocator, Growth>::iterator
+small_vector<T, N, Allocator, Growth>::emplace(const_iterator pos,
+                                               Args&&... args) {
+  size_type position = pos - begin();
+  if (position == size_) {
+    emplace_back(std::forward<Args>(args)...);
+    return data_ + position;
+  }
+  // args may refer to an element that is about to move
+  value_type tmp(std::forward<Args>(args)...);
+  return this->InsertWith(position, 1, [this, &tmp](T* gap) {
+    Construct(gap, std::move(tmp));
+  });
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename... Args>
+typename small_vector<T, N, Allocator, Growth>::reference
+small_vector<T, N, Allocator, Growth>::emplace_back(Args&&... args) {
+  if (size_ == capacity_) {
+    // args may refer to an element that is about to move
+    value_type tmp(std::forward<Args>(args)...);
+    return *this->InsertWith(size_, 1, [this, &tmp](T* gap) {
+      Construct(gap, std::move(tmp));
+    });
+  }
+  Construct(data_ + size_, std::forward<Args>(args)...);
+  ++size_;
+  return data_[size_ - 1];
+}
+
+// Arguments may refer to elements of this small_vector.
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename... Args>
+typename small_vector<T, N, Allocator, Growth>::iterator
+small_vector<T, N, Allocator, Growth>::insert_many(const_iterator pos,
+                                                   Args&&... args) {
+  return this->InsertMany(pos - begin(), std::forward<Args>(args)...);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename... Args>
+void small_vector<T, N, Allocator, Growth>::insert_many_back(Args&&... args) {
+  insert_many(end(), std::forward<Args>(args)...);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+T* small_vector<T, N, Allocator, Growth>::Allocate(size_type n) {
+  return alloc_traits::allocate(alloc_, n);
+}
+
+// Frees the heap buffer, if any, and falls back to the inline storage.
+template <typename T, size_t N, typename Allocator, typename Growth>
+void small_vector<T, N, Allocator, Growth>::Release() {
+  if (!is_inline()) {
+    alloc_traits::deallocate(alloc_, data_, capacity_);
+  }
+  data_ = Inline();
+  capacity_ = N;
+}
+
+// Moves the elements into a buffer of new_capacity (the inline one when it
+// fits), leaving gap_size raw slots at gap_pos. The two buffers always differ.
+// On exception the elements stay where they were.
+template <typename T, size_t N, typename Allocator, typename Growth>
+void small_vector<T, N, Allocator, Growth>::MoveTo(size_type new_capacity,
+                                                   size_type gap_pos,
+                                                   size_type gap_size) {
+  bool to_inline = new_capacity <= N;
+  T* new_data = to_inline ? Inline() : Allocate(new_capacity);
+  try {
+    MoveToBuffer(data_, data_ + size_, new_data, gap_pos, gap_size);
+  } catch (...) {
+    if (!to_inline) {
+      alloc_traits::deallocate(alloc_, new_data, new_capacity);
+    }
+    throw;
+  }
+  Release();
+  data_ = new_data;
+  capacity_ = to_inline ? N : new_capacity;
+  if (!is_inline()) {
+    ++reallocations_;
+  }
+}
+
+}  // namespace s21
+
+#endif
@@ -1,11 +1,47 @@
 #ifndef S21_VECTOR_H
 #define S21_VECTOR_H
 
-#include "../s21_container.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector_base.h"
 
 namespace s21 {
-template <class T>
-class vector {
+// Growth policies decide the new capacity when push_back/insert run out of
+// room. Any default-constructible functor with the same call signature can be
+// plugged in as the third template argument of vector, after the allocator.
+template <size_t Numerator, size_t Denominator>
+struct geometric_growth {
+  static_assert(Numerator > Denominator, "growth factor must be above 1");
+
+  size_t operator()(size_t capacity, size_t required) const {
+    size_t grown = capacity;
+    if (capacity <= std::numeric_limits<size_t>::max() / Numerator) {
+      grown = capacity * Numerator / Denominator;
+    }
+    return grown < required ? required : grown;
+  }
+};
+
+using growth_factor_2 = geometric_growth<2, 1>;
+using growth_factor_1_5 = geometric_growth<3, 2>;
+
+// Memory is obtained through Allocator via std::allocator_traits, so any
+// std-conforming allocator (arena, pool, ...) can be plugged in.
+template <class T, class Allocator = std::allocator<T>,
+          class Growth = growth_factor_2>
+class vector : public s21_VectorBase<T, Allocator, Growth,
+                                     vector<T, Allocator, Growth>> {
  public:
   using value_type = T;
   using reference = T&;
@@ -13,17 +49,27 @@ class vector {
   using iterator = T*;
   using const_iterator = const T*;
   using size_type = size_t;
+  using allocator_type = Allocator;
+
+  static_assert(std::is_same_v<typename Allocator::value_type, T>,
+                "Allocator::value_type must be T");
+  static_assert(std::is_invocable_r_v<size_t, const Growth&, size_t, size_t>,
+                "Growth must map (capacity, required) to a new capacity");
 
-  vector() : data_(nullptr), size_(0), capacity_(0){};
-  vector(size_type n) : data_(new T[n]), size_(n), capacity_(n){};
+  vector() : vector(Allocator()){};
+  explicit vector(const Allocator& alloc)
+      : base_type(alloc){};
+  vector(size_type n);
   vector(std::initializer_list<value_type> const& items);
   vector(const vector& v);
   vector(vector&& v);
 
-  ~vector(){};
+  ~vector();
 
   vector& operator=(vector&& v);
 
+  allocator_type get_allocator() { return alloc_; };
+
   reference at(size_type pos);
   reference operator[](size_type pos);
   const_reference front() { return *data_; };
@@ -33,193 +79,382 @@ class vector {
   iterator begin() { return data_; };
   iterator end() { return data_ + size_; };
 
-  bool empty() { return data_ == nullptr; };
+  bool empty() { return size_ == 0; };
   size_type size() { return size_; };
   size_type max_size();
   void reserve(size_type size);
   size_type capacity() { return capacity_; };
+  size_type reallocation_count() { return reallocations_; };
   void shrink_to_fit();
 
   void clear();
   iterator insert(iterator pos, const_reference value);
-  void erase(iterator pos);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
   void push_back(const_reference value);
+  void push_back(value_type&& value);
   void pop_back();
   void swap(vector& other);
 
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args&&... args);
   template <typename... Args>
   void insert_many_back(Args&&... args);
 
  private:
-  T* data_;
-  size_type size_;
-  size_type capacity_;
+  using base_type = s21_VectorBase<T, Allocator, Growth, vector>;
+  friend base_type;
+  using typename base_type::alloc_traits;
+  using base_type::alloc_;
+  using base_type::capacity_;
+  using base_type::data_;
+  using base_type::reallocations_;
+  using base_type::size_;
+  using base_type::Construct;
+  using base_type::ConstructN;
+  using base_type::CopyInto;
+  using base_type::Destroy;
+  using base_type::MoveToBuffer;
+  using base_type::NextCapacity;
+
+  T* Allocate(size_type n);
+  void Deallocate(T* ptr, size_type n);
+  void MoveInto(T* new_data, size_type gap_pos, size_type gap_size);
+  void MoveTo(size_type new_capacity, size_type gap_pos, size_type gap_size);
+  template <typename... Args>
+  void GrowAndEmplace(size_type position, Args&&... args);
+  void SwapStorage(vector& other);
 };
 
-template <typename T>
-vector<T>::vector(std::initializer_list<value_type> const& items)
-    : vector(items.size()) {
-  for (size_type i = 0; i < size_; ++i) {
-    data_[i] = *(items.begin() + i);
+template <typename T, typename Allocator, typename Growth>
+vector<T, Allocator, Growth>::vector(size_type n) : vector() {
+  data_ = Allocate(n);
+  capacity_ = n;
+  try {
+    ConstructN(data_, n);
+  } catch (...) {
+    Deallocate(data_, capacity_);
+    throw;
   }
+  size_ = n;
 }
 
-template <typename T>
-vector<T>::vector(const vector<T>& v) : vector(v.size_) {
-  for (size_type i = 0; i < size_; ++i) {
-    data_[i] = v.data_[i];
+template <typename T, typename Allocator, typename Growth>
+vector<T, Allocator, Growth>::vector(
+    std::initializer_list<value_type> const& items)
+    : vector() {
+  data_ = Allocate(items.size());
+  capacity_ = items.size();
+  try {
+    CopyInto(items.begin(), items.end(), data_);
+  } catch (...) {
+    Deallocate(data_, capacity_);
+    throw;
   }
+  size_ = items.size();
 }
 
-template <typename T>
-vector<T>::vector(vector<T>&& v) {
+template <typename T, typename Allocator, typename Growth>
+vector<T, Allocator, Growth>::vector(const vector& v)
+    : vector(alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+  data_ = Allocate(v.size_);
+  capacity_ = v.size_;
+  try {
+    CopyInto(v.data_, v.data_ + v.size_, data_);
+  } catch (...) {
+    Deallocate(data_, capacity_);
+    throw;
+  }
   size_ = v.size_;
-  v.size_ = 0;
-  capacity_ = v.capacity_;
-  v.capacity_ = 0;
-  data_ = v.data_;
-  v.data_ = nullptr;
 }
 
-template <typename T>
-vector<T>& vector<T>::operator=(vector<T>&& v) {
-  if (this != &v) {
-    this->swap(v);
+template <typename T, typename Allocator, typename Growth>
+vector<T, Allocator, Growth>::vector(vector&& v) : vector(std::move(v.alloc_)) {
+  SwapStorage(v);
+}
+
+template <typename T, typename Allocator, typename Growth>
+vector<T, Allocator, Growth>::~vector() {
+  Destroy(data_, data_ + size_);
+  Deallocate(data_, capacity_);
+}
+
+// The buffer is stolen when the allocator follows it (or both allocators are
+// interchangeable); otherwise the elements are moved one by one into memory
+// from our own allocator.
+template <typename T, typename Allocator, typename Growth>
+vector<T, Allocator, Growth>& vector<T, Allocator, Growth>::operator=(
+    vector&& v) {
+  if (this == &v) return *this;
+  clear();
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    alloc_ = std::move(v.alloc_);
+    SwapStorage(v);
+  } else if (alloc_ == v.alloc_) {
+    SwapStorage(v);
+  } else {
+    reserve(v.size_);
+    for (T* it = v.data_; it != v.data_ + v.size_; ++it) {
+      Construct(data_ + size_, std::move(*it));
+      ++size_;
+    }
+    v.clear();
   }
+  v.reallocations_ = 0;
   return *this;
 }
 
-template <typename T>
-typename vector<T>::reference vector<T>::at(size_type pos) {
+template <typename T, typename Allocator, typename Growth>
+typename vector<T, Allocator, Growth>::reference
+vector<T, Allocator, Growth>::at(size_type pos) {
   if (pos >= size_ || size_ == 0) {
     throw std::out_of_range("Index out range");
   }
   return data_[pos];
 }
 
-template <typename T>
-typename vector<T>::reference vector<T>::operator[](size_type pos) {
+template <typename T, typename Allocator, typename Growth>
+typename vector<T, Allocator, Growth>::reference
+vector<T, Allocator, Growth>::operator[](size_type pos) {
   return *(data_ + pos);
 }
 
-template <typename T>
-void vector<T>::reserve(size_type size) {
+template <typename T, typename Allocator, typename Growth>
+void vector<T, Allocator, Growth>::reserve(size_type size) {
   if (size > max_size() - size_) {
     throw std::length_error("Can't allocate memory of this size");
   }
-  if (size >= size_) {
-    vector<value_type> tmp(size);
-    for (size_type i = 0; i < size_; ++i) {
-      tmp.data_[i] = data_[i];
-    }
-    tmp.size_ = size_;
-    *this = std::move(tmp);
+  if (size > capacity_) {
+    MoveTo(size, size_, 0);
   }
 }
 
-template <typename T>
-void vector<T>::shrink_to_fit() {
+template <typename T, typename Allocator, typename Growth>
+void vector<T, Allocator, Growth>::shrink_to_fit() {
   if (size_ != capacity_) {
-    vector<value_type> tmp(size_);
-    for (size_type i = 0; i < size_; ++i) {
-      tmp.data_[i] = data_[i];
-    }
-    *this = std::move(tmp);
+    MoveTo(size_, size_, 0);
   }
 }
 
-template <typename T>
-void vector<T>::clear() {
-  delete[] data_;
+template <typename T, typename Allocator, typename Growth>
+void vector<T, Allocator, Growth>::clear() {
+  Destroy(data_, data_ + size_);
+  Deallocate(data_, capacity_);
   data_ = nullptr;
   size_ = 0;
+  capacity_ = 0;
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::insert(iterator pos,
-                                               const_reference value) {
-  vector<value_type> tmp(size_ + 1);
-  size_type j = 0, position = pos - this->begin();
-  for (size_type i = 0; i < tmp.size_; ++i) {
-    if (i == position) {
-      tmp.data_[i] = value;
-    } else {
-      tmp.data_[i] = data_[j++];
-    }
+template <typename T, typename Allocator, typename Growth>
+typename vector<T, Allocator, Growth>::iterator
+vector<T, Allocator, Growth>::insert(iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, typename Allocator, typename Growth>
+typename vector<T, Allocator, Growth>::iterator
+vector<T, Allocator, Growth>::insert(const_iterator pos, size_type count,
+                                     const_reference value) {
+  return this->InsertCopies(pos - begin(), count, value);
+}
+
+// The range must not point into this vector.
+template <typename T, typename Allocator, typename Growth>
+template <typename InputIt, typename>
+typename vector<T, Allocator, Growth>::iterator
+vector<T, Allocator, Growth>::insert(const_iterator pos, InputIt first,
+                                     InputIt last) {
+  return this->InsertRange(pos - begin(), first, last);
+}
+
+template <typename T, typename Allocator, typename Growth>
+template <typename... Args>
+typename vector<T, Allocator, Growth>::iterator
+vector<T, Allocator, Growth>::emplace(const_iterator pos, Args&&... args) {
+  size_type position = pos - begin();
+  if (position == size_) {
+    emplace_back(std::forward<Args>(args)...);
+    return data_ + position;
   }
-  *this = std::move(tmp);
+  if (size_ == capacity_) {
+    GrowAndEmplace(position, std::forward<Args>(args)...);
+  } else {
+    // args may refer to an element that is about to be shifted
+    value_type tmp(std::forward<Args>(args)...);
+    Construct(data_ + size_, std::move(data_[size_ - 1]));
+    std::move_backward(data_ + position, data_ + size_ - 1, data_ + size_);
+    data_[position] = std::move(tmp);
+  }
+  ++size_;
   return data_ + position;
 }
 
-template <typename T>
-void vector<T>::erase(iterator pos) {
-  vector<value_type> tmp(size_ - 1);
-  size_type j = 0, position = pos - this->begin();
-  for (size_type i = 0; i < size_; ++i) {
-    if (i != position) {
-      tmp.data_[j++] = data_[i];
-    }
+template <typename T, typename Allocator, typename Growth>
+template <typename... Args>
+typename vector<T, Allocator, Growth>::reference
+vector<T, Allocator, Growth>::emplace_back(Args&&... args) {
+  if (size_ == capacity_) {
+    GrowAndEmplace(size_, std::forward<Args>(args)...);
+  } else {
+    Construct(data_ + size_, std::forward<Args>(args)...);
   }
-  *this = std::move(tmp);
+  ++size_;
+  return data_[size_ - 1];
 }
 
-template <typename T>
-typename vector<T>::size_type vector<T>::max_size() {
-  return std::numeric_limits<std::size_t>::max() / sizeof(value_type);
+template <typename T, typename Allocator, typename Growth>
+typename vector<T, Allocator, Growth>::iterator
+vector<T, Allocator, Growth>::erase(const_iterator pos) {
+  return erase(pos, pos + 1);
 }
 
-template <typename T>
-void vector<T>::push_back(const_reference value) {
-  if (capacity_ > size_) {
-    data_[size_] = value;
-    size_ += 1;
-  } else {
-    vector<value_type> tmp(size_ + 1);
-    for (size_type i = 0; i < size_; ++i) {
-      tmp.data_[i] = data_[i];
-    }
-    tmp[size_] = value;
-    *this = std::move(tmp);
-  }
+// Removes [first, last) in place: the tail slides left and capacity is kept.
+template <typename T, typename Allocator, typename Growth>
+typename vector<T, Allocator, Growth>::iterator
+vector<T, Allocator, Growth>::erase(const_iterator first, const_iterator last) {
+  return this->EraseRange(data_ + (first - data_), data_ + (last - data_));
+}
+
+template <typename T, typename Allocator, typename Growth>
+typename vector<T, Allocator, Growth>::size_type
+vector<T, Allocator, Growth>::max_size() {
+  return base_type::MaxSize();
+}
+
+template <typename T, typename Allocator, typename Growth>
+void vector<T, Allocator, Growth>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator, typename Growth>
+void vector<T, Allocator, Growth>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
 }
 
-template <typename T>
-void vector<T>::pop_back() {
+template <typename T, typename Allocator, typename Growth>
+void vector<T, Allocator, Growth>::pop_back() {
   size_ -= 1;
+  Destroy(data_ + size_, data_ + size_ + 1);
 }
 
-template <typename T>
-void vector<T>::swap(vector& other) {
-  value_type* tmp_arr = data_;
-  size_type tmp_size = size_;
-  size_type tmp_capacity = capacity_;
-  data_ = other.data_;
-  size_ = other.size_;
-  capacity_ = other.capacity_;
-  other.data_ = tmp_arr;
-  other.size_ = tmp_size;
-  other.capacity_ = tmp_capacity;
+// Allocators are exchanged only when they propagate on swap; otherwise they
+// must compare equal.
+template <typename T, typename Allocator, typename Growth>
+void vector<T, Allocator, Growth>::swap(vector& other) {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+  SwapStorage(other);
 }
 
-template <typename T>
+// Arguments may refer to elements of this vector.
+template <typename T, typename Allocator, typename Growth>
 template <typename... Args>
-typename vector<T>::iterator vector<T>::insert_many(const_iterator pos,
-                                                    Args&&... args) {
-  vector<value_type> temp{args...};
-  iterator cur_pos = begin() + (pos - begin());
-  for (size_t i = 0; i < temp.size(); ++i) {
-    cur_pos = insert(cur_pos, temp[i]);
-    ++cur_pos;
+typename vector<T, Allocator, Growth>::iterator
+vector<T, Allocator, Growth>::insert_many(const_iterator pos,
+                                          Args&&... args) {
+  return this->InsertMany(pos - begin(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator, typename Growth>
+template <typename... Args>
+void vector<T, Allocator, Growth>::insert_many_back(Args&&... args) {
+  insert_many(end(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator, typename Growth>
+T* vector<T, Allocator, Growth>::Allocate(size_type n) {
+  if (n == 0) return nullptr;
+  return alloc_traits::allocate(alloc_, n);
+}
+
+template <typename T, typename Allocator, typename Growth>
+void vector<T, Allocator, Growth>::Deallocate(T* ptr, size_type n) {
+  if (ptr == nullptr) return;
+  alloc_traits::deallocate(alloc_, ptr, n);
+}
+
+// Moves the elements into new_data (copies them when T's move constructor may
+// throw), leaving gap_size slots untouched at gap_pos, and releases the current
+// buffer. On exception the current buffer is left untouched.
+template <typename T, typename Allocator, typename Growth>
+void vector<T, Allocator, Growth>::MoveInto(T* new_data, size_type gap_pos,
+                                            size_type gap_size) {
+  MoveToBuffer(data_, data_ + size_, new_data, gap_pos, gap_size);
+  Deallocate(data_, capacity_);
+}
+
+// Moves the elements into a fresh buffer of new_capacity, leaving gap_size
+// raw slots at gap_pos. On exception the current buffer is left untouched.
+template <typename T, typename Allocator, typename Growth>
+void vector<T, Allocator, Growth>::MoveTo(size_type new_capacity,
+                                          size_type gap_pos,
+                                          size_type gap_size) {
+  T* new_data = Allocate(new_capacity);
+  try {
+    MoveInto(new_data, gap_pos, gap_size);
+  } catch (...) {
+    Deallocate(new_data, new_capacity);
+    throw;
   }
-  return cur_pos;
+  data_ = new_data;
+  capacity_ = new_capacity;
+  ++reallocations_;
 }
 
-template <typename T>
+// Builds the new element in a larger buffer, then moves the old elements
+// around it. The element is built before the old buffer goes away, so args
+// may still refer to our own elements. size_ is left to the caller.
+template <typename T, typename Allocator, typename Growth>
 template <typename... Args>
-void vector<T>::insert_many_back(Args&&... args) {
-  insert_many(end(), args...);
+void vector<T, Allocator, Growth>::GrowAndEmplace(size_type position,
+                                                  Args&&... args) {
+  size_type new_capacity = NextCapacity(size_ + 1);
+  T* new_data = Allocate(new_capacity);
+  try {
+    Construct(new_data + position, std::forward<Args>(args)...);
+  } catch (...) {
+    Deallocate(new_data, new_capacity);
+    throw;
+  }
+  try {
+    MoveInto(new_data, position, 1);
+  } catch (...) {
+    Destroy(new_data + position, new_data + position + 1);
+    Deallocate(new_data, new_capacity);
+    throw;
+  }
+  data_ = new_data;
+  capacity_ = new_capacity;
+  ++reallocations_;
+}
+
+template <typename T, typename Allocator, typename Growth>
+void vector<T, Allocator, Growth>::SwapStorage(vector& other) {
+  std::swap(data_, other.data_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(reallocations_, other.reallocations_);
+}
+
+// Removes every element matching pred with a single compaction pass and
+// returns how many were removed. Capacity is left unchanged.
+template <typename T, typename Allocator, typename Growth, typename Predicate>
+typename vector<T, Allocator, Growth>::size_type erase_if(
+    vector<T, Allocator, Growth>& v, Predicate pred) {
+  auto new_end = std::remove_if(v.begin(), v.end(), pred);
+  typename vector<T, Allocator, Growth>::size_type removed = v.end() - new_end;
+  v.erase(new_end, v.end());
+  return removed;
 }
 
 }  // namespace s21
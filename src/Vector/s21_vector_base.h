@@ -0,0 +1,316 @@
+#ifndef S21_VECTOR_BASE_H
+#define S21_VECTOR_BASE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Contiguous storage shared by vector and small_vector: the element buffer,
+// elements built, destroyed and moved through Allocator, and the insert and
+// erase logic. Where the buffer lives is up to Derived, which grows it in
+// MoveTo(new_capacity, gap_pos, gap_size): move the elements into a buffer of
+// new_capacity, leaving gap_size raw slots at gap_pos, or throw and leave
+// them where they were.
+template <class T, class Allocator, class Growth, class Derived>
+class s21_VectorBase {
+ protected:
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using size_type = size_t;
+
+  explicit s21_VectorBase(const Allocator& alloc)
+      : alloc_(alloc),
+        data_(nullptr),
+        size_(0),
+        capacity_(0),
+        reallocations_(0){};
+
+  Allocator alloc_;
+  T* data_;
+  size_type size_;
+  size_type capacity_;
+  size_type reallocations_;
+
+  template <typename... Args>
+  void Construct(T* ptr, Args&&... args);
+  template <typename... Args>
+  void ConstructN(T* dst, size_type n, const Args&... args);
+  template <typename InputIt>
+  void ConstructRange(InputIt first, InputIt last, T* dst);
+  void Destroy(T* first, T* last);
+  void CopyInto(const T* first, const T* last, T* dst);
+  void Relocate(T* first, T* last, T* dst);
+  void MoveToBuffer(T* first, T* last, T* dst, size_type gap_pos,
+                    size_type gap_size);
+
+  T* InsertCopies(size_type position, size_type count, const T& value);
+  template <typename InputIt>
+  T* InsertRange(size_type position, InputIt first, InputIt last);
+  template <typename... Args>
+  T* InsertMany(size_type position, Args&&... args);
+  T* EraseRange(T* from, T* to);
+
+  T* OpenGap(size_type position, size_type count);
+  void CloseGap(size_type position, size_type count);
+  template <typename Fill>
+  T* InsertWith(size_type position, size_type count, Fill fill);
+  static size_type MaxSize() {
+    return std::numeric_limits<std::size_t>::max() / sizeof(T);
+  };
+  size_type NextCapacity(size_type required);
+  bool Contains(const void* ptr) const;
+
+ private:
+  Derived& Self() { return static_cast<Derived&>(*this); };
+};
+
+template <class T, class Allocator, class Growth, class Derived>
+template <typename... Args>
+void s21_VectorBase<T, Allocator, Growth, Derived>::Construct(
+    T* ptr, Args&&... args) {
+  alloc_traits::construct(alloc_, ptr, std::forward<Args>(args)...);
+}
+
+// Builds n elements from args (value-initialized when there are none); on
+// exception the ones already built are destroyed.
+template <class T, class Allocator, class Growth, class Derived>
+template <typename... Args>
+void s21_VectorBase<T, Allocator, Growth, Derived>::ConstructN(
+    T* dst, size_type n, const Args&... args) {
+  T* cur = dst;
+  try {
+    for (; n != 0; --n, ++cur) {
+      Construct(cur, args...);
+    }
+  } catch (...) {
+    Destroy(dst, cur);
+    throw;
+  }
+}
+
+template <class T, class Allocator, class Growth, class Derived>
+template <typename InputIt>
+void s21_VectorBase<T, Allocator, Growth, Derived>::ConstructRange(
+    InputIt first, InputIt last, T* dst) {
+  T* cur = dst;
+  try {
+    for (; first != last; ++first, ++cur) {
+      Construct(cur, *first);
+    }
+  } catch (...) {
+    Destroy(dst, cur);
+    throw;
+  }
+}
+
+template <class T, class Allocator, class Growth, class Derived>
+void s21_VectorBase<T, Allocator, Growth, Derived>::Destroy(T* first, T* last) {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (; first != last; ++first) {
+      alloc_traits::destroy(alloc_, first);
+    }
+  }
+}
+
+// Copy-constructs [first, last) into raw storage at dst.
+template <class T, class Allocator, class Growth, class Derived>
+void s21_VectorBase<T, Allocator, Growth, Derived>::CopyInto(
+    const T* first, const T* last, T* dst) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (first != last) {
+      std::memcpy(static_cast<void*>(dst), static_cast<const void*>(first),
+                  (last - first) * sizeof(T));
+    }
+  } else {
+    ConstructRange(first, last, dst);
+  }
+}
+
+// Moves [first, last) to dst and ends the lifetime of the source objects. The
+// ranges may overlap.
+template <class T, class Allocator, class Growth, class Derived>
+void s21_VectorBase<T, Allocator, Growth, Derived>::Relocate(
+    T* first, T* last, T* dst) {
+  if (first == last || first == dst) return;
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::memmove(static_cast<void*>(dst), static_cast<const void*>(first),
+                 (last - first) * sizeof(T));
+  } else if (dst < first) {
+    for (; first != last; ++first, ++dst) {
+      Construct(dst, std::move(*first));
+      alloc_traits::destroy(alloc_, first);
+    }
+  } else {
+    for (dst += last - first; first != last;) {
+      --last;
+      --dst;
+      Construct(dst, std::move(*last));
+      alloc_traits::destroy(alloc_, last);
+    }
+  }
+}
+
+// Moves [first, last) into the separate raw buffer dst (copies them when T's
+// move constructor may throw), leaving gap_size slots untouched at gap_pos,
+// and destroys the sources. On exception the sources are left untouched and
+// dst is raw again.
+template <class T, class Allocator, class Growth, class Derived>
+void s21_VectorBase<T, Allocator, Growth, Derived>::MoveToBuffer(
+    T* first, T* last, T* dst, size_type gap_pos, size_type gap_size) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    CopyInto(first, first + gap_pos, dst);
+    CopyInto(first + gap_pos, last, dst + gap_pos + gap_size);
+  } else {
+    size_type size = last - first;
+    size_type i = 0;
+    try {
+      for (; i < size; ++i) {
+        T* slot = dst + i + (i < gap_pos ? 0 : gap_size);
+        Construct(slot, std::move_if_noexcept(first[i]));
+      }
+    } catch (...) {
+      for (size_type j = 0; j < i; ++j) {
+        T* slot = dst + j + (j < gap_pos ? 0 : gap_size);
+        Destroy(slot, slot + 1);
+      }
+      throw;
+    }
+    Destroy(first, last);
+  }
+}
+
+template <class T, class Allocator, class Growth, class Derived>
+T* s21_VectorBase<T, Allocator, Growth, Derived>::InsertCopies(
+    size_type position, size_type count, const T& value) {
+  if (Contains(std::addressof(value))) {
+    T copy(value);
+    return InsertCopies(position, count, copy);
+  }
+  return InsertWith(position, count, [this, &value, count](T* gap) {
+    ConstructN(gap, count, value);
+  });
+}
+
+// The range must not point into this container.
+template <class T, class Allocator, class Growth, class Derived>
+template <typename InputIt>
+T* s21_VectorBase<T, Allocator, Growth, Derived>::InsertRange(
+    size_type position, InputIt first, InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    size_type count = std::distance(first, last);
+    return InsertWith(position, count, [this, &first, &last](T* gap) {
+      ConstructRange(first, last, gap);
+    });
+  } else {
+    size_type old_size = size_;
+    for (; first != last; ++first) {
+      Self().emplace_back(*first);
+    }
+    std::rotate(data_ + position, data_ + old_size, data_ + size_);
+    return data_ + position;
+  }
+}
+
+// Opens room for all the arguments at once. Arguments that refer to elements
+// of this container are copied out first, as opening the gap may move them.
+// Returns the element after the inserted ones.
+template <class T, class Allocator, class Growth, class Derived>
+template <typename... Args>
+T* s21_VectorBase<T, Allocator, Growth, Derived>::InsertMany(
+    size_type position, Args&&... args) {
+  if ((Contains(std::addressof(args)) || ...)) {
+    return InsertMany(position, T(std::forward<Args>(args))...);
+  }
+  constexpr size_type count = sizeof...(Args);
+  InsertWith(position, count, [this, &args...](T* gap) {
+    T* cur = gap;
+    try {
+      (Construct(cur++, std::forward<Args>(args)), ...);
+    } catch (...) {
+      Destroy(gap, cur - 1);
+      throw;
+    }
+  });
+  return data_ + position + count;
+}
+
+// Removes [from, to) in place: the tail slides left and capacity is kept.
+template <class T, class Allocator, class Growth, class Derived>
+T* s21_VectorBase<T, Allocator, Growth, Derived>::EraseRange(T* from, T* to) {
+  Destroy(from, to);
+  Relocate(to, data_ + size_, from);
+  size_ -= to - from;
+  return from;
+}
+
+// Leaves count raw slots at position, growing the buffer at most once and
+// moving the tail a single time. size_ already includes the gap on return.
+template <class T, class Allocator, class Growth, class Derived>
+T* s21_VectorBase<T, Allocator, Growth, Derived>::OpenGap(size_type position,
+                                                          size_type count) {
+  if (size_ + count > capacity_) {
+    Self().MoveTo(NextCapacity(size_ + count), position, count);
+  } else {
+    Relocate(data_ + position, data_ + size_, data_ + position + count);
+  }
+  size_ += count;
+  return data_ + position;
+}
+
+// Reverts OpenGap when filling the gap failed; the gap must be raw again.
+template <class T, class Allocator, class Growth, class Derived>
+void s21_VectorBase<T, Allocator, Growth, Derived>::CloseGap(
+    size_type position, size_type count) {
+  Relocate(data_ + position + count, data_ + size_, data_ + position);
+  size_ -= count;
+}
+
+// fill constructs exactly count elements in the gap, or destroys whatever it
+// has built before throwing.
+template <class T, class Allocator, class Growth, class Derived>
+template <typename Fill>
+T* s21_VectorBase<T, Allocator, Growth, Derived>::InsertWith(
+    size_type position, size_type count, Fill fill) {
+  if (count != 0) {
+    T* gap = OpenGap(position, count);
+    try {
+      fill(gap);
+    } catch (...) {
+      CloseGap(position, count);
+      throw;
+    }
+  }
+  return data_ + position;
+}
+
+template <class T, class Allocator, class Growth, class Derived>
+typename s21_VectorBase<T, Allocator, Growth, Derived>::size_type
+s21_VectorBase<T, Allocator, Growth, Derived>::NextCapacity(
+    size_type required) {
+  if (required > MaxSize()) {
+    throw std::length_error("Can't allocate memory of this size");
+  }
+  size_type new_capacity = Growth()(capacity_, required);
+  if (new_capacity > MaxSize()) new_capacity = MaxSize();
+  return new_capacity < required ? required : new_capacity;
+}
+
+// Whether ptr points into one of the elements.
+template <class T, class Allocator, class Growth, class Derived>
+bool s21_VectorBase<T, Allocator, Growth, Derived>::Contains(
+    const void* ptr) const {
+  return std::greater_equal<const void*>()(ptr, data_) &&
+         std::less<const void*>()(ptr, data_ + size_);
+}
+
+}  // namespace s21
+
+#endif
@@ -3,5 +3,12 @@
 
 #include "Multiset/s21_multiset.h"
 #include "Array/s21_array.h"
+#include "Vector/s21_small_vector.h"
+#include "Queue/s21_concurrent_queue.h"
+#include "Queue/s21_spsc_queue.h"
+#include "Stack/s21_concurrent_stack.h"
+#include "List/s21_unrolled_list.h"
+#include "Map/s21_btree_map.h"
+#include "Set/s21_btree_set.h"
 
 #endif
\ No newline at end of file